@@ -42,6 +42,18 @@ Nfa minimize_brzozowski(const Nfa& aut);
  */
 Nfa minimize_hopcroft(const Nfa& dfa_trimmed);
 
+/**
+ * Valmari-Lehtinen minimization of partial deterministic automata, based on the paper:
+ *  "Efficient Minimization of DFAs With Partial Transition Functions" by Antti Valmari and Petri Lehtinen.
+ *  Irrelevant states (unreachable or not reaching a final state) are removed first, so neither trimming nor completing
+ *  @p dfa is needed. Blocks of states and cords of transitions (over a common symbol to a common block) are refined
+ *  against each other; a split always gives the new index to the smaller half, so the algorithm works in
+ *  O(n + m*log(n)) time, where n is the number of states and m is the number of transitions.
+ * @param[in] dfa Deterministic automaton.
+ * @return Minimized trimmed deterministic automaton; a single initial non-final state if the language is empty.
+ */
+Nfa minimize_valmari(const Nfa& dfa);
+
 /**
  * Complement implemented by determization, adding sink state and making automaton complete. Then it adds final states
  *  which were non final in the original automaton.
@@ -49,9 +61,12 @@ Nfa minimize_hopcroft(const Nfa& dfa_trimmed);
  * @param[in] symbols Symbols needed to make the automaton complete.
  * @param[in] minimize_during_determinization Whether the determinized automaton is computed by (brzozowski)
  *  minimization.
+ * @param[in] first_epsilon The first symbol to handle as an epsilon during the determinization (see
+ *  @c determinize()). All symbols are ordinary symbols if not given.
  * @return Complemented automaton.
  */
-Nfa complement_classical(const Nfa& aut, const mata::utils::OrdVector<Symbol>& symbols);
+Nfa complement_classical(const Nfa& aut, const mata::utils::OrdVector<Symbol>& symbols,
+                         std::optional<Symbol> first_epsilon = std::nullopt);
 
 /**
  * Complement implemented by determization using Brzozowski minimization, adding a sink state and making the automaton
@@ -86,6 +101,117 @@ bool is_included_naive(const Nfa& smaller, const Nfa& bigger, const Alphabet* al
  */
 bool is_included_antichains(const Nfa& smaller, const Nfa& bigger, const Alphabet*  alphabet = nullptr, Run* cex = nullptr);
 
+/**
+ * Inclusion implemented by antichain algorithms on frozen automata.
+ *
+ * Works as @c is_included_antichains() for @c Nfa, but reads the transitions from the contiguous @c FrozenDelta.
+ * @param[out] cex A potential counterexample word which breaks inclusion
+ */
+bool is_included_antichains(const FrozenNfa& smaller, const FrozenNfa& bigger, const Alphabet* alphabet = nullptr,
+                            Run* cex = nullptr);
+
+/**
+ * Inclusion implemented by antichain algorithms run by @p num_of_threads threads.
+ *
+ * Threads pop pairs of a state of @p smaller and a macrostate of @p bigger from work-stealing queues, the antichain of
+ *  processed pairs is split by states of @p smaller, each part guarded by its own mutex. The first thread which finds
+ *  a counterexample stops the others.
+ * @param[in] smaller Automaton which language should be included in the bigger one
+ * @param[in] bigger Automaton which language should include the smaller one
+ * @param[in] num_of_threads Number of threads (a single thread runs @c is_included_antichains()).
+ * @param[out] cex A potential counterexample word which breaks inclusion
+ * @return True if smaller language is included,
+ * i.e., if the final intersection of smaller complement of bigger is empty.
+ */
+bool is_included_antichains_parallel(const Nfa& smaller, const Nfa& bigger, size_t num_of_threads,
+                                     Run* cex = nullptr);
+
+/**
+ * Inclusion implemented by antichain algorithms enhanced with simulations (Abdulla et al., When Simulation Meets
+ *  Antichains, TACAS'10).
+ *
+ * A forward simulation is computed over the union of both automata. Macrostates of @p bigger are minimized by
+ *  removing simulated states, a pair (p, P) is subsumed by a processed pair (r, R) if r simulates p and each state of
+ *  R is simulated by a state of P, and pairs where p is simulated by a state of P are not explored.
+ * @param[in] smaller Automaton which language should be included in the bigger one
+ * @param[in] bigger Automaton which language should include the smaller one
+ * @param[in] alphabet Alphabet of both automata (not needed for antichain algorithm)
+ * @param[out] cex A potential counterexample word which breaks inclusion
+ * @return True if smaller language is included,
+ * i.e., if the final intersection of smaller complement of bigger is empty.
+ */
+bool is_included_antichains_sim(const Nfa& smaller, const Nfa& bigger, const Alphabet* alphabet = nullptr,
+                                Run* cex = nullptr);
+
+/**
+ * Inclusion implemented by bisimulation up to congruence (HKC, Bonchi and Pous, Checking NFA Equivalence with
+ *  Bisimulations up to Congruence, POPL'13).
+ *
+ * Pairs (X + Y, Y) of macrostates of @p smaller and @p bigger are explored in a depth-first order, skipping pairs in
+ *  the congruence closure of the pairs already explored or waiting to be explored, which is checked by comparing normal
+ *  forms of both macrostates under rewriting by the pairs.
+ * @param[in] smaller Automaton which language should be included in the bigger one
+ * @param[in] bigger Automaton which language should include the smaller one
+ * @param[in] alphabet Alphabet of both automata (not needed for HKC)
+ * @param[out] cex A potential counterexample word which breaks inclusion (only the word is set, the path is empty)
+ * @return True if smaller language is included,
+ * i.e., if the final intersection of smaller complement of bigger is empty.
+ */
+bool is_included_hkc(const Nfa& smaller, const Nfa& bigger, const Alphabet* alphabet = nullptr, Run* cex = nullptr);
+
+/**
+ * Inclusion implemented by bisimulation up to congruence and similarity (HKC').
+ *
+ * Works as @c is_included_hkc(), but the congruence closure is also closed under the forward simulation computed over
+ *  the union of both automata: a macrostate is rewritten to contain the states simulated by its states.
+ * @param[out] cex A potential counterexample word which breaks inclusion (only the word is set, the path is empty)
+ */
+bool is_included_hkc_sim(const Nfa& smaller, const Nfa& bigger, const Alphabet* alphabet = nullptr,
+                         Run* cex = nullptr);
+
+/**
+ * Equivalence implemented by bisimulation up to congruence (HKC), a single symmetric exploration of pairs of
+ *  macrostates of @p lhs and @p rhs (see @c is_included_hkc()).
+ * @param[out] cex A potential word in exactly one of the languages (only the word is set, the path is empty)
+ * @param[in] up_to_similarity Whether to close the congruence under the forward simulation (see
+ *  @c is_included_hkc_sim()).
+ * @return True if the languages of @p lhs and @p rhs are equal.
+ */
+bool are_equivalent_hkc(const Nfa& lhs, const Nfa& rhs, Run* cex = nullptr, bool up_to_similarity = false);
+
+/**
+ * Get the representation of macrostates in subset constructions selected by the "macrostate" key of @p params:
+ *  "sorted-vector" (default) for @c StateSet, or "adaptive" for @c mata::utils::AdaptiveSet.
+ * @return True if "adaptive" is selected.
+ */
+bool use_adaptive_macrostates(const ParameterMap& params);
+
+/**
+ * Get the number of threads selected by the "threads" key of @p params: a positive number, or "0" for the number of
+ *  hardware threads. Defaults to a single thread.
+ */
+size_t get_num_of_threads(const ParameterMap& params);
+
+/**
+ * Get the first epsilon symbol selected by the "first_epsilon" key of @p params (a decimal number).
+ * @return The first epsilon, or @c std::nullopt if the key is not set.
+ */
+std::optional<Symbol> get_first_epsilon(const ParameterMap& params);
+
+/**
+ * @brief Remove transitions over @p epsilon from @p delta, replacing them by transitions from epsilon closures.
+ *
+ * Epsilon transitions are traversed once by Tarjan's algorithm: states of an epsilon SCC share a single closure and a
+ *  single state post, and the closure of an SCC is computed from the closures of its successor SCCs when the SCC is
+ *  finished (in reverse topological order). State posts are built in one pass from the sorted moves of the closure.
+ * Shared by @c mata::nfa::remove_epsilon() and @c mata::nft::remove_epsilon().
+ * @param[in] delta Transitions with epsilon transitions.
+ * @param[in] epsilon Epsilon symbol.
+ * @param[in,out] final Final states; states with a final state in their epsilon closure are added.
+ * @return Transitions without epsilon transitions.
+ */
+Delta remove_epsilon_transitions(const Delta& delta, Symbol epsilon, utils::SparseSet<State>& final);
+
 /**
  * Universality check implemented by checking emptiness of complemented automaton
  * @param[in] aut Automaton which universality is checked
@@ -104,10 +230,67 @@ bool is_universal_naive(const Nfa& aut, const Alphabet& alphabet, Run* cex);
  */
 bool is_universal_antichains(const Nfa& aut, const Alphabet& alphabet, Run* cex);
 
+/**
+ * Universality checking based on subset construction with antichain enhanced with the forward simulation on @p aut.
+ *
+ * Macrostates are minimized by removing simulated states, and a macrostate is subsumed by a processed macrostate whose
+ *  states are all simulated by its states.
+ * @param[in] aut Automaton which universality is checked
+ * @param[in] alphabet Alphabet of the automaton
+ * @param[out] cex Counterexample word which eventually breaks the universality
+ * @return True if the automaton is universal, otherwise false.
+ */
+bool is_universal_antichains_sim(const Nfa& aut, const Alphabet& alphabet, Run* cex);
+
+/**
+ * Universality checking by bisimulation up to congruence, as inclusion of the universal language over @p alphabet in
+ *  the language of @p aut (see @c is_included_hkc()).
+ * @param[in] aut Automaton which universality is checked
+ * @param[in] alphabet Alphabet of the automaton
+ * @param[out] cex Counterexample word which eventually breaks the universality
+ * @return True if the automaton is universal, otherwise false.
+ */
+bool is_universal_hkc(const Nfa& aut, const Alphabet& alphabet, Run* cex);
+
+/**
+ * Universality checking by bisimulation up to congruence and similarity (see @c is_included_hkc_sim()).
+ */
+bool is_universal_hkc_sim(const Nfa& aut, const Alphabet& alphabet, Run* cex);
+
+/**
+ * @brief Compute a relation on the states of @p aut.
+ *
+ * @param[in] params Parameters of the relation:
+ * - "relation": "simulation" (maximal direct simulation, see @c compute_direct_simulation()),
+ * - "direction": "forward" (final states are simulated only by final states), "backward" (over reverted transitions,
+ *      initial states are simulated only by initial states).
+ * @return The relation where (p, q) holds if q simulates p.
+ */
 Simlib::Util::BinaryRelation compute_relation(
         const Nfa& aut,
         const ParameterMap&  params = {{ "relation", "simulation"}, { "direction", "forward"}});
 
+/**
+ * @brief Compute the maximal direct simulation over the transitions of @p delta.
+ *
+ * State q simulates p if q is distinguished whenever p is, and for each transition p -a-> p', there is a transition
+ *  q -a-> q' where q' simulates p'. The transitions are read from @p delta directly (no symbol is added for the
+ *  distinguished states). The relation is refined in a bit matrix by counters of simulating successors kept for each
+ *  pair of a symbol post and an a-predecessor set over the same symbol, with the narrowest counter type fitting the
+ *  largest out-degree; it is converted to a @c BinaryRelation at the end.
+ * @param[in] delta Transitions.
+ * @param[in] num_of_states Number of states (at least the number of states of @p delta).
+ * @param[in] distinguished States simulated only by distinguished states: final states for forward simulations,
+ *  initial states for backward simulations.
+ * @param[in] backward Whether to compute the simulation over reverted transitions.
+ * @return The relation where (p, q) holds if q simulates p.
+ */
+Simlib::Util::BinaryRelation compute_direct_simulation(
+        const Delta& delta, size_t num_of_states, const utils::SparseSet<State>& distinguished, bool backward = false);
+Simlib::Util::BinaryRelation compute_direct_simulation(
+        const FrozenDelta& delta, size_t num_of_states, const utils::SparseSet<State>& distinguished,
+        bool backward = false);
+
 /**
  * @brief Compute product of two NFAs, final condition is to be specified, with a possibility of using multiple epsilons.
  *
@@ -123,6 +306,32 @@ Simlib::Util::BinaryRelation compute_relation(
 Nfa product(const Nfa& lhs, const Nfa& rhs, const std::function<bool(State,State)> && final_condition,
             const Symbol first_epsilon = EPSILON, std::unordered_map<std::pair<State,State>, State> *prod_map = nullptr);
 
+/**
+ * @brief Compute product of two frozen NFAs, final condition is to be specified, with a possibility of using multiple
+ *  epsilons.
+ *
+ * Works as @c product() for @c Nfa, but reads the transitions from the contiguous @c FrozenDelta.
+ */
+Nfa product(const FrozenNfa& lhs, const FrozenNfa& rhs, const std::function<bool(State,State)> && final_condition,
+            const Symbol first_epsilon = EPSILON, std::unordered_map<std::pair<State,State>, State> *prod_map = nullptr);
+
+/**
+ * @brief Compute product of several NFAs at once, final condition is to be specified, with a possibility of using
+ *  multiple epsilons.
+ *
+ * Explores tuples of states of @p nfas directly instead of folding the binary @c product() over intermediate products.
+ *  Transitions over ordinary symbols are synchronized over all the NFAs, an ε-transition of a single NFA moves only its
+ *  own state in the tuple.
+ * @param[in] nfas NFAs to compute product for.
+ * @param[in] final_condition The predicate that tells whether a tuple of states is final (conjunction for intersection).
+ * @param[in] first_epsilon The smallest epsilon.
+ * @param[in] useful_states If given, tuples with a state `q` of the i-th NFA where `(*useful_states)[i][q]` does not
+ *  hold are never created (use the useful states of the NFAs to build an intersection trimmed on the fly).
+ * @return NFA as a product of @p nfas with ε-transitions preserved.
+ */
+Nfa product(const std::vector<const Nfa*>& nfas, const std::function<bool(std::span<const State>)>& final_condition,
+            Symbol first_epsilon = EPSILON, const std::vector<BoolVector>* useful_states = nullptr);
+
 /**
  * @brief Concatenate two NFAs.
  *
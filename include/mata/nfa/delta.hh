@@ -8,10 +8,18 @@
 #include "mata/alphabet.hh"
 #include "mata/nfa/types.hh"
 
+#include <exception>
 #include <iterator>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 namespace mata::nfa {
 
+class FrozenDelta;
+
 /// A single transition in Delta represented as a triple(source, symbol, target).
 struct Transition {
     State source; ///< Source state.
@@ -44,16 +52,18 @@ public:
  * Structure represents a post of a single @c symbol: a set of target states in transitions.
  *
  * A set of @c SymbolPost, called @c StatePost, is describing the automata transitions from a single source state.
+ * The targets are stored in a @c TargetSet, which keeps a few targets inline without a heap allocation.
  */
 class SymbolPost {
 public:
     Symbol symbol{};
-    StateSet targets{};
+    TargetSet targets{};
 
     SymbolPost() = default;
     explicit SymbolPost(Symbol symbol) : symbol{ symbol }, targets{} {}
     SymbolPost(Symbol symbol, State state_to) : symbol{ symbol }, targets{ state_to } {}
-    SymbolPost(Symbol symbol, StateSet states_to) : symbol{ symbol }, targets{ std::move(states_to) } {}
+    SymbolPost(Symbol symbol, TargetSet states_to) : symbol{ symbol }, targets{ std::move(states_to) } {}
+    SymbolPost(Symbol symbol, const StateSet& states_to) : symbol{ symbol }, targets{ states_to } {}
 
     SymbolPost(SymbolPost&& rhs) noexcept : symbol{ rhs.symbol }, targets{ std::move(rhs.targets) } {}
     SymbolPost(const SymbolPost& rhs) = default;
@@ -63,11 +73,11 @@ public:
     std::weak_ordering operator<=>(const SymbolPost& other) const { return symbol <=> other.symbol; }
     bool operator==(const SymbolPost& other) const { return symbol == other.symbol; }
 
-    StateSet::iterator begin() { return targets.begin(); }
-    StateSet::iterator end() { return targets.end(); }
+    TargetSet::iterator begin() { return targets.begin(); }
+    TargetSet::iterator end() { return targets.end(); }
 
-    StateSet::const_iterator cbegin() const { return targets.cbegin(); }
-    StateSet::const_iterator cend() const { return targets.cend(); }
+    TargetSet::const_iterator cbegin() const { return targets.cbegin(); }
+    TargetSet::const_iterator cend() const { return targets.cend(); }
 
     size_t count(State s) const { return targets.count(s); }
     bool empty() const { return targets.empty(); }
@@ -75,6 +85,7 @@ public:
 
     void insert(State s);
     void insert(const StateSet& states);
+    void insert(const TargetSet& states);
 
     // THIS BREAKS THE SORTEDNESS INVARIANT,
     // dangerous,
@@ -82,15 +93,15 @@ public:
     void inline push_back(const State s) { targets.push_back(s); }
 
     template <typename... Args>
-    StateSet& emplace_back(Args&&... args) {
+    State& emplace_back(Args&&... args) {
 	// Forwardinng the variadic template pack of arguments to the emplace_back() of the underlying container.
         return targets.emplace_back(std::forward<Args>(args)...);
     }
 
     void erase(State s) { targets.erase(s); }
 
-    std::vector<State>::const_iterator find(State s) const { return targets.find(s); }
-    std::vector<State>::iterator find(State s) { return targets.find(s); }
+    TargetSet::const_iterator find(State s) const { return targets.find(s); }
+    TargetSet::iterator find(State s) { return targets.find(s); }
 }; // class mata::nfa::SymbolPost.
 
 /**
@@ -99,9 +110,9 @@ public:
  * It is an ordered vector containing possible @c SymbolPost (i.e., pair of symbol and target states).
  * @c SymbolPosts in the vector are ordered by symbols in @c SymbolPosts.
  */
-class StatePost : private utils::OrdVector<SymbolPost> {
+class StatePost : private utils::OrdVector<SymbolPost, std::vector<SymbolPost, TransitionAllocator<SymbolPost>>> {
 private:
-    using super = utils::OrdVector<SymbolPost>;
+    using super = utils::OrdVector<SymbolPost, std::vector<SymbolPost, TransitionAllocator<SymbolPost>>>;
 public:
     using super::iterator, super::const_iterator;
     using super::begin, super::end, super::cbegin, super::cend;
@@ -202,7 +213,7 @@ class StatePost::Moves::const_iterator {
 private:
     const StatePost* state_post_{ nullptr };
     StatePost::const_iterator symbol_post_it_{};
-    StateSet::const_iterator target_it_{};
+    TargetSet::const_iterator target_it_{};
     StatePost::const_iterator symbol_post_end_{};
     bool is_end_{ false };
     /// Internal allocated instance of @c Move which is set for the move currently iterated over and returned as
@@ -243,7 +254,7 @@ public:
 /**
  * @brief Specialization of utils::SynchronizedExistentialIterator for iterating over SymbolPosts.
  */
-class SynchronizedExistentialSymbolPostIterator : public utils::SynchronizedExistentialIterator<utils::OrdVector<SymbolPost>::const_iterator> {
+class SynchronizedExistentialSymbolPostIterator : public utils::SynchronizedExistentialIterator<StatePost::const_iterator> {
 public:
     /**
      * @brief Get union of all targets.
@@ -288,11 +299,12 @@ public:
 
     Delta(): state_posts_{} {}
     Delta(const Delta& other) = default;
-    Delta(Delta&& other) = default;
+    Delta(Delta&& other) noexcept
+        : state_posts_{ std::move(other.state_posts_) }, content_id_{ other.content_id_ } { other.content_changed(); }
     explicit Delta(size_t n): state_posts_{ n } {}
 
     Delta& operator=(const Delta& other) = default;
-    Delta& operator=(Delta&& other) = default;
+    Delta& operator=(Delta&& other) noexcept;
 
     bool operator==(const Delta& other) const;
 
@@ -351,10 +363,14 @@ public:
     template <typename... Args>
     StatePost& emplace_back(Args&&... args) {
 	// Forwarding the variadic template pack of arguments to the emplace_back() of the underlying container.
+        content_changed();
         return state_posts_.emplace_back(std::forward<Args>(args)...);
     }
 
-    void clear() { state_posts_.clear(); }
+    void clear() {
+        content_changed();
+        state_posts_.clear();
+    }
 
     /**
      * @brief Allocate state posts up to @p num_of_states states, creating empty @c StatePost for yet unallocated state
@@ -365,6 +381,7 @@ public:
      */
     void allocate(const size_t num_of_states) {
         assert(num_of_states >= this->num_of_states());
+        content_changed();
         state_posts_.resize(num_of_states);
     }
 
@@ -409,6 +426,7 @@ public:
      * @param post_vector Vector of posts to be appended.
      */
     void append(const std::vector<StatePost>& post_vector) {
+        content_changed();
         for(const StatePost& pst : post_vector) {
             this->state_posts_.push_back(pst);
         }
@@ -435,6 +453,17 @@ public:
      */
     void add(const State source, const Symbol symbol, const StateSet& targets);
 
+    /**
+     * @brief Add many transitions at once.
+     *
+     * The transitions can come in any order and may repeat or already be in @c Delta. Instead of a sorted insertion
+     *  per transition, the transitions are distributed to their source states by a counting sort, the moves of each
+     *  source state are sorted, and the state post is built in one pass. Use when constructing automata from parsed
+     *  or generated transitions.
+     * @param[in] transitions Transitions to add. The vector is consumed.
+     */
+    void add_bulk(std::vector<Transition>&& transitions);
+
     using const_iterator = std::vector<StatePost>::const_iterator;
     const_iterator cbegin() const { return state_posts_.cbegin(); }
     const_iterator cend() const { return state_posts_.cend(); }
@@ -448,12 +477,103 @@ public:
      */
     Transitions transitions() const;
 
+    /**
+     * @brief Call @p function(source, symbol, target) for each transition, in the order of @c transitions().
+     *
+     * Prefer to iterating over @c transitions() in performance-critical loops: the traversal is a plain nested loop
+     *  over state posts, symbol posts and targets, which the compiler inlines together with @p function.
+     */
+    template<class Function>
+    void for_each_transition(Function&& function) const {
+        for_each_transition(0, static_cast<State>(num_of_states()), function);
+    }
+
+    /**
+     * @brief Call @p function(source, symbol, target) for each transition from sources in [@p first_source,
+     *  @p last_source).
+     */
+    template<class Function>
+    void for_each_transition(const State first_source, const State last_source, Function&& function) const {
+        for (State source{ first_source }; source < last_source; ++source) {
+            for (const SymbolPost& symbol_post: state_posts_[source]) {
+                for (const State target: symbol_post.targets) { function(source, symbol_post.symbol, target); }
+            }
+        }
+    }
+
+    /**
+     * @brief Call @p function(symbol, target) for each move from @p source, in the order of @c StatePost::moves().
+     */
+    template<class Function>
+    void for_each_move(const State source, Function&& function) const {
+        for (const SymbolPost& symbol_post: state_post(source)) {
+            for (const State target: symbol_post.targets) { function(symbol_post.symbol, target); }
+        }
+    }
+
+    /// Minimal number of source states in a chunk processed by a worker thread of @c reduce_by_chunks().
+    static constexpr size_t MIN_STATES_PER_CHUNK{ 1024 };
+
+    /**
+     * @brief Split source states into contiguous chunks of about the same number of symbol posts.
+     *
+     * @param[in] num_of_chunks Maximal number of chunks. Fewer chunks are created for automata with less than
+     *  @c MIN_STATES_PER_CHUNK states per chunk.
+     * @return Chunks as pairs of the first and one past the last source state, covering all states in order.
+     */
+    std::vector<std::pair<State, State>> split_into_chunks(size_t num_of_chunks) const;
+
+    /**
+     * @brief Run a read-only pass over the transition relation split into chunks of source states in parallel.
+     *
+     * Each chunk is processed by @p chunk_function(first_source, last_source), returning a partial result. The partial
+     *  results are combined by @p combine(result, partial_result) in the order of chunks, so the result does not
+     *  depend on the number of threads whenever @p combine is associative. Chunks are processed by worker threads and
+     *  the calling thread; an exception thrown by any chunk is rethrown after all chunks finish.
+     *
+     * @c Delta must not be modified during the pass.
+     * @param[in] result Initial result, the partial results are combined into.
+     * @param[in] num_of_threads Number of threads to use, 0 for the number of hardware threads.
+     */
+    template<class Result, class ChunkFunction, class Combine>
+    Result reduce_by_chunks(Result result, ChunkFunction&& chunk_function, Combine&& combine,
+                            size_t num_of_threads = 0) const {
+        if (num_of_threads == 0) { num_of_threads = std::max(std::thread::hardware_concurrency(), 1u); }
+        const std::vector<std::pair<State, State>> chunks{ split_into_chunks(num_of_threads) };
+        if (chunks.size() == 1) {
+            combine(result, chunk_function(chunks.front().first, chunks.front().second));
+            return result;
+        }
+        std::vector<std::optional<Result>> partial_results(chunks.size());
+        std::vector<std::exception_ptr> exceptions(chunks.size());
+        const auto process_chunk = [&](const size_t chunk_index) {
+            try {
+                partial_results[chunk_index].emplace(
+                    chunk_function(chunks[chunk_index].first, chunks[chunk_index].second));
+            } catch (...) { exceptions[chunk_index] = std::current_exception(); }
+        };
+        {
+            std::vector<std::jthread> workers{};
+            workers.reserve(chunks.size() - 1);
+            for (size_t chunk_index{ 1 }; chunk_index < chunks.size(); ++chunk_index) {
+                workers.emplace_back(process_chunk, chunk_index);
+            }
+            process_chunk(0);
+        } // Joins the workers.
+        for (const std::exception_ptr& exception: exceptions) {
+            if (exception) { std::rethrow_exception(exception); }
+        }
+        for (std::optional<Result>& partial_result: partial_results) { combine(result, std::move(*partial_result)); }
+        return result;
+    }
+
     /**
      * Get transitions leading to @p state_to.
      * @param state_to[in] Target state for transitions to get.
      * @return Transitions leading to @p state_to.
      *
-     * Operation is slow, traverses over all symbol posts.
+     * Operation is slow, traverses over all symbol posts. For repeated queries, use @c PredecessorIndex (e.g., through
+     *  @c Nfa::pre()).
      */
     std::vector<Transition> get_transitions_to(State state_to) const;
 
@@ -489,6 +609,7 @@ public:
     utils::OrdVector<Symbol> get_used_symbols() const;
 
     utils::OrdVector<Symbol> get_used_symbols_vec() const;
+    utils::OrdVector<Symbol> get_used_symbols_par() const;
     std::set<Symbol> get_used_symbols_set() const;
     utils::SparseSet<Symbol> get_used_symbols_sps() const;
     std::vector<bool> get_used_symbols_bv() const;
@@ -498,8 +619,31 @@ public:
      * @brief Get the maximum non-epsilon used symbol.
      */
     Symbol get_max_symbol() const;
+
+    /**
+     * @brief Create a read-only snapshot of the transition relation packed into contiguous arrays.
+     *
+     * The snapshot does not reflect any later changes of this @c Delta.
+     */
+    FrozenDelta freeze() const;
+
+    /**
+     * @brief Get an identifier of the current content of @c Delta.
+     *
+     * The identifier stays the same until @c Delta is modified by any non-constant method (including handing out
+     *  a mutable state post by @c mutable_state_post()). A copy has the same identifier as its source until either of
+     *  them is modified. Caches derived from @c Delta (such as @c PredecessorIndex) use the identifier to detect that
+     *  they are stale.
+     */
+    size_t content_id() const;
 protected:
     std::vector<StatePost> state_posts_;
+
+    /// Identifier of the current content, 0 when the content changed since @c content_id() was last called.
+    mutable size_t content_id_{ 0 };
+
+    /// Record that the content changed. Called by all modifying methods.
+    void content_changed() { content_id_ = 0; }
 }; // class Delta.
 
 /**
@@ -529,9 +673,9 @@ private:
 class Delta::Transitions::const_iterator {
 private:
     const Delta* delta_ = nullptr;
-    size_t current_state_{};
+    State current_state_{};
     StatePost::const_iterator state_post_it_{};
-    StateSet::const_iterator symbol_post_it_{};
+    TargetSet::const_iterator symbol_post_it_{};
     bool is_end_{ false };
     Transition transition_{};
 
@@ -563,6 +707,174 @@ public:
     bool operator==(const const_iterator& other) const;
 }; // class Delta::Transitions::const_iterator.
 
+/**
+ * @brief Symbol post of a @c FrozenDelta: a @c symbol and a view of the ordered target states of the symbol.
+ *
+ * The targets are not owned by the symbol post; they point into the contiguous array of targets of the @c FrozenDelta
+ *  the symbol post belongs to.
+ */
+class FrozenSymbolPost {
+public:
+    Symbol symbol{};
+    std::span<const State> targets{};
+
+    std::weak_ordering operator<=>(const FrozenSymbolPost& other) const { return symbol <=> other.symbol; }
+    bool operator==(const FrozenSymbolPost& other) const { return symbol == other.symbol; }
+
+    std::span<const State>::iterator begin() const { return targets.begin(); }
+    std::span<const State>::iterator end() const { return targets.end(); }
+
+    std::span<const State>::iterator cbegin() const { return targets.begin(); }
+    std::span<const State>::iterator cend() const { return targets.end(); }
+
+    bool empty() const { return targets.empty(); }
+    size_t num_of_targets() const { return targets.size(); }
+}; // class FrozenSymbolPost.
+
+/**
+ * @brief State post of a @c FrozenDelta: a view of the symbol posts of a single source state ordered by symbols.
+ */
+class FrozenStatePost : public std::span<const FrozenSymbolPost> {
+public:
+    using std::span<const FrozenSymbolPost>::span;
+    using const_iterator = iterator;
+
+    /**
+     * Find the symbol post of @p symbol.
+     * @return An iterator to the symbol post of @p symbol, or end() if there is no such symbol post.
+     */
+    const_iterator find(Symbol symbol) const;
+
+    ///returns an iterator to the smallest epsilon, or end() if there is no epsilon
+    const_iterator first_epsilon_it(Symbol first_epsilon) const;
+}; // class FrozenStatePost.
+
+/**
+ * @brief Read-only snapshot of @c Delta packed into contiguous compressed-sparse-row arrays.
+ *
+ * The relation is stored in three arrays: offsets of the first symbol post of each state (with an extra offset behind
+ *  the last state), symbol posts of all states ordered by their source states and symbols, and targets of all symbol
+ *  posts. Each symbol post keeps its symbol and the range of its targets in the array of targets. Successors of a state
+ *  are therefore stored next to each other and reading them needs no pointer chasing over separately allocated
+ *  state posts and target sets.
+ *
+ * The snapshot is meant for algorithms which query the transition relation many times without modifying it. Create it
+ *  with @c Delta::freeze() once the automaton is constructed.
+ */
+class FrozenDelta {
+public:
+    FrozenDelta() = default;
+    explicit FrozenDelta(const Delta& delta);
+    FrozenDelta(const FrozenDelta& other);
+    FrozenDelta(FrozenDelta&& other) noexcept = default;
+
+    FrozenDelta& operator=(const FrozenDelta& other);
+    FrozenDelta& operator=(FrozenDelta&& other) noexcept = default;
+
+    /**
+     * @brief Get the state post of @p source.
+     *
+     * If @p source has no allocated state post in the snapshot, an empty state post is returned.
+     */
+    FrozenStatePost state_post(const State source) const {
+        if (source >= num_of_states()) { return {}; }
+        return { symbol_posts_.data() + state_offsets_[source], symbol_posts_.data() + state_offsets_[source + 1] };
+    }
+
+    FrozenStatePost operator[](const State source) const { return state_post(source); }
+
+    /**
+     * @return Number of states in the snapshot, including both source and target states.
+     */
+    size_t num_of_states() const { return state_offsets_.empty() ? 0 : state_offsets_.size() - 1; }
+
+    /**
+     * @return Number of transitions in the snapshot.
+     */
+    size_t num_of_transitions() const { return targets_.size(); }
+
+    /**
+     * Check whether the snapshot contains no transitions.
+     */
+    bool empty() const { return targets_.empty(); }
+
+    /**
+     * Check whether the snapshot contains the transition (@p source, @p symbol, @p target).
+     */
+    bool contains(State source, Symbol symbol, State target) const;
+
+    /**
+     * @brief Create a (mutable) @c Delta with the transitions of the snapshot.
+     */
+    Delta thaw() const;
+
+protected:
+    /// Index of the first symbol post of each state in @c symbol_posts_, followed by the number of all symbol posts.
+    std::vector<size_t> state_offsets_{ 0 };
+    std::vector<FrozenSymbolPost> symbol_posts_{}; ///< Symbol posts ordered by their source states and symbols.
+    std::vector<State> targets_{}; ///< Targets of all symbol posts, viewed by @c FrozenSymbolPost::targets.
+}; // class FrozenDelta.
+
+/**
+ * @brief Index of predecessors of states: the reversed transition relation of a @c Delta packed as a @c FrozenDelta.
+ *
+ * The state post of a state @c q lists, ordered by symbols, the symbols of transitions leading to @c q, each with the
+ *  ordered sources of those transitions. The index is a snapshot; it does not reflect later changes of the @c Delta it
+ *  was built from. @c Nfa keeps one built on demand (see @c Nfa::predecessors()).
+ */
+class PredecessorIndex : public FrozenDelta {
+public:
+    PredecessorIndex() = default;
+    explicit PredecessorIndex(const Delta& delta);
+
+    /**
+     * Get the ordered predecessors of @p state over @p symbol.
+     */
+    std::span<const State> pre(State state, Symbol symbol) const;
+
+    /**
+     * Get the predecessors of @p state over all symbols, grouped by symbols.
+     */
+    FrozenStatePost pre(const State state) const { return state_post(state); }
+}; // class PredecessorIndex.
+
+/**
+ * @brief Specialization of utils::SynchronizedExistentialIterator for iterating over FrozenSymbolPosts.
+ */
+class SynchronizedExistentialFrozenSymbolPostIterator
+    : public utils::SynchronizedExistentialIterator<FrozenStatePost::const_iterator> {
+public:
+    /**
+     * @brief Get union of all targets.
+     */
+    StateSet unify_targets() const;
+
+    /**
+     * @brief Synchronize with the given symbol @p sync_symbol.
+     *
+     * Alignes the synchronized iterator to the same symbol as @p sync_symbol.
+     * @return True iff the synchronized iterator points to the same symbol as @p sync_symbol.
+     */
+    bool synchronize_with(Symbol sync_symbol);
+
+    /**
+     * @brief Synchronize with the given symbol post @p sync.
+     *
+     * Alignes the synchronized iterator to the same symbol as @p sync.
+     * @return True iff the synchronized iterator points to the same symbol as @p sync.
+     */
+    bool synchronize_with(const FrozenSymbolPost& sync) { return synchronize_with(sync.symbol); }
+}; // class SynchronizedExistentialFrozenSymbolPostIterator.
+
+/**
+ * Synchronized existential iterator over symbol posts of the transition relation of type @p DeltaType (either
+ *  @c Delta or @c FrozenDelta).
+ */
+template<class DeltaType>
+using SynchronizedExistentialSymbolPostIteratorOf = std::conditional_t<
+    std::is_same_v<DeltaType, FrozenDelta>, SynchronizedExistentialFrozenSymbolPostIterator,
+    SynchronizedExistentialSymbolPostIterator>;
+
 } // namespace mata::nfa.
 
 #endif //MATA_DELTA_HH
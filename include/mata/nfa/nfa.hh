@@ -89,7 +89,9 @@ public:
 
     Nfa(Nfa&& other) noexcept
         : delta{ std::move(other.delta) }, initial{ std::move(other.initial) }, final{ std::move(other.final) },
-          alphabet{ other.alphabet }, attributes{ std::move(other.attributes) } { other.alphabet = nullptr; }
+          alphabet{ other.alphabet }, attributes{ std::move(other.attributes) },
+          predecessor_index_{ std::move(other.predecessor_index_) },
+          predecessor_index_content_id_{ other.predecessor_index_content_id_ } { other.alphabet = nullptr; }
 
     Nfa& operator=(const Nfa& other) = default;
     Nfa& operator=(Nfa&& other) noexcept;
@@ -148,7 +150,7 @@ public:
     /**
      * Swap final and non-final states in-place.
      */
-    Nfa& swap_final_nonfinal() { final.complement(num_of_states()); return *this; }
+    Nfa& swap_final_nonfinal() { final.complement(static_cast<State>(num_of_states())); return *this; }
 
     bool is_state(const State& state_to_check) const { return state_to_check < num_of_states(); }
 
@@ -186,6 +188,25 @@ public:
      */
     StateSet get_terminating_states() const;
 
+    /**
+     * @brief Get the index of predecessors of states.
+     *
+     * The index is built on the first call and kept until @c delta is modified; the next call after a modification
+     *  rebuilds it. Copies of the automaton share the index until either of them is modified.
+     *
+     * The lazy (re)building is not thread-safe. When querying the index from multiple threads, call this method once
+     *  beforehand and share the returned reference.
+     * @return Index of predecessors of the current @c delta. The reference is invalidated by the next rebuild.
+     */
+    const PredecessorIndex& predecessors() const;
+
+    /**
+     * @brief Get the ordered predecessors of @p state over @p symbol.
+     *
+     * Uses the index of predecessors, see @c predecessors().
+     */
+    std::span<const State> pre(const State state, const Symbol symbol) const { return predecessors().pre(state, symbol); }
+
     /**
      * @brief Get the useful states using a modified Tarjan's algorithm. A state
      * is useful if it is reachable from an initial state and can reach a final state.
@@ -405,7 +426,8 @@ public:
      */
     void fill_alphabet(mata::OnTheFlyAlphabet& alphabet_to_fill) const;
 
-    /// Is the language of the automaton universal?
+    /// Is the language of the automaton universal? The parameters are the same as for @c is_included() (a single
+    ///  thread is used).
     bool is_universal(const Alphabet& alphabet, Run* cex = nullptr,
                       const ParameterMap& params = {{ "algorithm", "antichains" }}) const;
     /// Is the language of the automaton universal?
@@ -495,8 +517,73 @@ public:
      * @pre @c this is a deterministic automaton.
      */
     Nfa& complement_deterministic(const mata::utils::OrdVector<Symbol>& symbols, std::optional<State> sink_state = std::nullopt);
+
+private:
+    /// Index of predecessors built on demand by @c predecessors(), shared by copies of the automaton.
+    mutable std::shared_ptr<const PredecessorIndex> predecessor_index_{};
+    /// @c Delta::content_id() of @c delta the index was built from.
+    mutable size_t predecessor_index_content_id_{ 0 };
 }; // class Nfa.
 
+/**
+ * @brief Read-only snapshot of an @c Nfa with the transition relation packed into a @c FrozenDelta.
+ *
+ * Use the snapshot when an automaton is constructed once and then queried many times (membership, inclusion,
+ *  products, determinization). The snapshot does not reflect any later changes of the original automaton.
+ */
+class FrozenNfa {
+public:
+    FrozenDelta delta;
+    utils::SparseSet<State> initial{};
+    utils::SparseSet<State> final{};
+
+    FrozenNfa() = default;
+    explicit FrozenNfa(const Nfa& aut): delta{ aut.delta.freeze() }, initial{ aut.initial }, final{ aut.final } {}
+
+    /**
+     * @brief Get the number of states in the whole automaton.
+     *
+     * This includes the initial and final states as well as states in the transition relation.
+     */
+    size_t num_of_states() const;
+
+    /**
+     * @brief Compute the set of states reachable from the initial states which can reach some final state.
+     *
+     * @return Bool vector whose ith value is true iff the state i is useful.
+     */
+    BoolVector get_useful_states() const;
+
+    /**
+     * Compute the lengths of the shortest paths from the initial states to each state.
+     * @return Distances indexed by states, @c Limits::max_state for unreachable states.
+     */
+    std::vector<State> distances_from_initial() const;
+
+    /**
+     * Compute the lengths of the shortest paths from each state to some final state.
+     * @return Distances indexed by states, @c Limits::max_state for states which cannot reach any final state.
+     */
+    std::vector<State> distances_to_final() const;
+
+    /**
+     * @brief Get some shortest accepting run from state @p q.
+     *
+     * Assumes that @p q is a state of this automaton and that there is some accepting run from @p q.
+     * @param[in] distances_to_final Vector of the lengths of the shortest runs from states (can be computed using
+     *  @c distances_to_final()).
+     */
+    Run get_shortest_accepting_run_from_state(State q, const std::vector<State>& distances_to_final) const;
+
+    /// Compute the post of @p states over @p symbol (epsilon transitions are not followed).
+    StateSet post(const StateSet& states, Symbol symbol) const;
+
+    /// Checks whether a word is in the language of an automaton.
+    bool is_in_lang(const Run& word) const;
+    /// Checks whether a word is in the language of an automaton.
+    bool is_in_lang(const Word& word) const { return is_in_lang(Run{ word, {} }); }
+}; // class FrozenNfa.
+
 // Allow variadic number of arguments of the same type.
 //
 // Using parameter pack and variadic arguments.
@@ -571,6 +658,17 @@ Nfa union_nondet(const Nfa &lhs, const Nfa &rhs);
 Nfa union_product(const Nfa &lhs, const Nfa &rhs, Symbol first_epsilon = EPSILON,
                   std::unordered_map<std::pair<State,State>,State> *prod_map = nullptr);
 
+/**
+ * @brief Compute union of several NFAs by a single product construction over tuples of their states.
+ *
+ * Works as folding the binary @c union_product(), but without constructing the intermediate products. NFAs without
+ *  initial or final states are skipped.
+ * @param[in] nfas NFAs to compute union for.
+ * @param[in] first_epsilon The first symbol to handle as an epsilon.
+ * @return Union by product construction of @p nfas.
+ */
+Nfa union_product(const std::vector<const Nfa*>& nfas, Symbol first_epsilon = EPSILON);
+
 /**
  * @brief Compute a language difference as @p nfa_included \ @p nfa_excluded.
  *
@@ -589,13 +687,16 @@ Nfa union_product(const Nfa &lhs, const Nfa &rhs, Symbol first_epsilon = EPSILON
         const StateSet& macrostate_excluded_state_set,
         const State macrostate,
         const Nfa& nfa_lang_difference.
- * @todo: TODO: Add support for specifying first epsilon symbol and compute epsilon closure during determinization.
+ * @param[in] first_epsilon The first symbol to handle as an epsilon. When given, macrostates of both NFAs are closed
+ *  under epsilon transitions during the determinization (see @c determinize()), so the NFAs may contain epsilon
+ *  transitions. Otherwise, all symbols are handled as ordinary symbols.
  */
 Nfa lang_difference(
     const Nfa &nfa_included, const Nfa &nfa_excluded,
     std::optional<
         std::function<bool(const Nfa&, const Nfa&, const StateSet&, const StateSet&, const State, const Nfa&)>
-    > macrostate_discover = std::nullopt
+    > macrostate_discover = std::nullopt,
+    std::optional<Symbol> first_epsilon = std::nullopt
 );
 
 /**
@@ -615,6 +716,37 @@ Nfa lang_difference(
 Nfa intersection(const Nfa& lhs, const Nfa& rhs,
                  const Symbol first_epsilon = EPSILON, std::unordered_map<std::pair<State, State>, State> *prod_map = nullptr);
 
+/**
+ * @brief Compute intersection of several NFAs by a single product construction over tuples of their states.
+ *
+ * Works as folding the binary @c intersection(), but without constructing the intermediate products, which is much
+ *  cheaper when most of them are large or when the whole intersection is empty. ε-transitions are preserved: an
+ *  ε-transition of a single NFA moves only its own state in the tuple.
+ * @param[in] nfas NFAs to compute intersection for (at least one).
+ * @param[in] first_epsilon smallest epsilon.
+ * @param[in] trim Whether to skip tuples with a state that cannot reach a final state of its NFA already during the
+ *  construction, and to trim the result.
+ * @return NFA as a product of @p nfas with ε-transitions preserved.
+ */
+Nfa intersection(const std::vector<const Nfa*>& nfas, Symbol first_epsilon = EPSILON, bool trim = false);
+
+/**
+ * @brief Check whether the intersection of the languages of several NFAs is empty.
+ *
+ * The product of @p nfas is explored on the fly and the search stops at the first discovered tuple of final states,
+ *  without constructing the product automaton. Symbols from @c EPSILON upwards are treated as ε-transitions.
+ * @param[in] nfas NFAs to check the intersection of (at least one).
+ * @param[out] cex Word accepted by all @p nfas if the intersection is not empty (only the word is set).
+ * @param[in] params Optional parameters to control the search:
+ *  - "algorithm":
+ *    - "dfs": Depth-first search of the product.
+ *    - "best-first": Skips states which cannot reach a final state and explores the tuple with the lowest maximal
+ *        distance of its states to final states first.
+ * @return True if the intersection is empty, false otherwise.
+ */
+bool is_intersection_empty(const std::vector<const Nfa*>& nfas, Run* cex = nullptr,
+                           const ParameterMap& params = {{ "algorithm", "dfs" }});
+
 /**
  * @brief Concatenate two NFAs.
  *
@@ -641,6 +773,7 @@ Nfa concatenate(const Nfa& lhs, const Nfa& rhs, bool use_epsilon = false,
  *                      non-final states.
  *      - "brzozowski": The Brzozowski algorithm determinizes the automaton using Brzozowski minimization, makes it
  *                       complete, and swaps final and non-final states.
+ * - "first_epsilon": The first symbol to handle as an epsilon (see @c determinize()); supported by "classical" only.
  * @return Complemented automaton.
  */
 Nfa complement(const Nfa& aut, const Alphabet& alphabet, const ParameterMap& params = { { "algorithm", "classical" } });
@@ -661,6 +794,7 @@ Nfa complement(const Nfa& aut, const Alphabet& alphabet, const ParameterMap& par
  *                      non-final states.
  *      - "brzozowski": The Brzozowski algorithm determinizes the automaton using Brzozowski minimization, makes it
  *                       complete, and swaps final and non-final states.
+ * - "first_epsilon": The first symbol to handle as an epsilon (see @c determinize()); supported by "classical" only.
  * @return Complemented automaton.
  */
 Nfa complement(const Nfa& aut, const utils::OrdVector<Symbol>& symbols,
@@ -671,7 +805,13 @@ Nfa complement(const Nfa& aut, const utils::OrdVector<Symbol>& symbols,
  *
  * @param[in] aut Automaton whose minimal version to compute.
  * @param[in] params Optional parameters to control the minimization algorithm:
- * - "algorithm": "brzozowski"
+ * - "algorithm":
+ *   - "brzozowski": Two determinizations of the reverted automaton.
+ *   - "hopcroft": Determinization (if @p aut is not deterministic), trimming and @c algorithms::minimize_hopcroft().
+ *   - "valmari": Determinization (if @p aut is not deterministic) and @c algorithms::minimize_valmari() on the
+ *        partial deterministic automaton.
+ *   - "auto": "valmari" for deterministic automata; a single determinization for co-deterministic trimmed automata
+ *        (their determinization is already minimal); otherwise, "valmari".
  * @return Minimal deterministic automaton.
  */
 Nfa minimize(const Nfa &aut, const ParameterMap& params = { { "algorithm", "brzozowski" } });
@@ -685,12 +825,33 @@ Nfa minimize(const Nfa &aut, const ParameterMap& params = { { "algorithm", "brzo
  *  parameters are the determinized NFA constructed so far, the current macrostate, and the set of the original states
  *  corresponding to the macrostate. Return @c true if the determinization should continue, and @c false if the
  *  determinization should stop and return only the determinized NFA constructed so far.
+ * @param[in] params Optional parameters:
+ * - "macrostate": "sorted-vector" (default) represents macrostates by sorted vectors, "adaptive" switches each
+ *      macrostate between a sorted vector and a bitset by its density (see @c mata::utils::AdaptiveSet), which is
+ *      faster for dense macrostates.
+ * - "threads": Number of threads exploring macrostates, "1" (default) or "0" for the number of hardware threads.
+ *      With more threads, the result is the same as with a single thread. Supported only for "sorted-vector"
+ *      macrostates. The determinization is sequential whenever @p macrostate_discover is given.
+ * - "first_epsilon": The first symbol to handle as an epsilon, as a decimal number (e.g., @c std::to_string(EPSILON)).
+ *      Macrostates are then closed under transitions over symbols greater or equal to it, with epsilon closures of
+ *      single states computed on demand and memoized, so @c remove_epsilon() does not have to be called first. The
+ *      determinized automaton has no epsilon transitions. By default, all symbols are handled as ordinary symbols.
  * @return Determinized automaton.
- * @todo: TODO: Add support for specifying first epsilon symbol and compute epsilon closure during determinization.
  */
 Nfa determinize(
     const Nfa& aut, std::unordered_map<StateSet, State> *subset_map = nullptr,
-    std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>> macrostate_discover = std::nullopt);
+    std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>> macrostate_discover = std::nullopt,
+    const ParameterMap& params = {});
+
+/**
+ * @brief Determinize a frozen automaton.
+ *
+ * Works as @c determinize() for @c Nfa, but reads the transitions of @p aut from the contiguous @c FrozenDelta.
+ */
+Nfa determinize(
+    const FrozenNfa& aut, std::unordered_map<StateSet, State> *subset_map = nullptr,
+    std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>> macrostate_discover = std::nullopt,
+    const ParameterMap& params = {});
 
 /**
  * @brief Reduce the size of the automaton.
@@ -715,7 +876,14 @@ Nfa reduce(const Nfa &aut, StateRenaming *state_renaming = nullptr,
  * @param[out] cex Counterexample for the inclusion.
  * @param[in] alphabet Alphabet of both NFAs to compute with.
  * @param[in] params Optional parameters to control the equivalence check algorithm:
- * - "algorithm": "naive", "antichains" (Default: "antichains")
+ * - "algorithm": "naive", "antichains", "antichains-sim" (antichains enhanced with forward simulations, see
+ *      @c algorithms::is_included_antichains_sim()), "hkc" (bisimulation up to congruence, see
+ *      @c algorithms::is_included_hkc()), "hkc-sim" (bisimulation up to congruence and similarity, see
+ *      @c algorithms::is_included_hkc_sim()) (Default: "antichains")
+ * - "macrostate": "sorted-vector", "adaptive" (Default: "sorted-vector"), representation of macrostates of "antichains",
+ *      see @c determinize()
+ * - "threads": number of threads of "antichains" with "sorted-vector" macrostates, "0" for the number of hardware
+ *      threads (Default: "1"), see @c algorithms::is_included_antichains_parallel()
  * @return True if @p smaller is included in @p bigger, false otherwise.
  */
 bool is_included(const Nfa& smaller, const Nfa& bigger, Run* cex, const Alphabet* alphabet = nullptr,
@@ -728,7 +896,14 @@ bool is_included(const Nfa& smaller, const Nfa& bigger, Run* cex, const Alphabet
  * @param[in] bigger Second automaton to concatenate.
  * @param[in] alphabet Alphabet of both NFAs to compute with.
  * @param[in] params Optional parameters to control the equivalence check algorithm:
- * - "algorithm": "naive", "antichains" (Default: "antichains")
+ * - "algorithm": "naive", "antichains", "antichains-sim" (antichains enhanced with forward simulations, see
+ *      @c algorithms::is_included_antichains_sim()), "hkc" (bisimulation up to congruence, see
+ *      @c algorithms::is_included_hkc()), "hkc-sim" (bisimulation up to congruence and similarity, see
+ *      @c algorithms::is_included_hkc_sim()) (Default: "antichains")
+ * - "macrostate": "sorted-vector", "adaptive" (Default: "sorted-vector"), representation of macrostates of "antichains",
+ *      see @c determinize()
+ * - "threads": number of threads of "antichains" with "sorted-vector" macrostates, "0" for the number of hardware
+ *      threads (Default: "1"), see @c algorithms::is_included_antichains_parallel()
  * @return True if @p smaller is included in @p bigger, false otherwise.
  */
 inline bool is_included(const Nfa& smaller, const Nfa& bigger, const Alphabet* const alphabet = nullptr,
@@ -743,7 +918,14 @@ inline bool is_included(const Nfa& smaller, const Nfa& bigger, const Alphabet* c
  * @param[in] rhs Second automaton to concatenate.
  * @param[in] alphabet Alphabet of both NFAs to compute with.
  * @param[in] params[ Optional parameters to control the equivalence check algorithm:
- * - "algorithm": "naive", "antichains" (Default: "antichains")
+ * - "algorithm": "naive", "antichains", "antichains-sim" (antichains enhanced with forward simulations, see
+ *      @c algorithms::is_included_antichains_sim()), "hkc" (bisimulation up to congruence, see
+ *      @c algorithms::is_included_hkc()), "hkc-sim" (bisimulation up to congruence and similarity, see
+ *      @c algorithms::is_included_hkc_sim()) (Default: "antichains")
+ * - "macrostate": "sorted-vector", "adaptive" (Default: "sorted-vector"), representation of macrostates of "antichains",
+ *      see @c determinize()
+ * - "threads": number of threads of "antichains" with "sorted-vector" macrostates, "0" for the number of hardware
+ *      threads (Default: "1"), see @c algorithms::is_included_antichains_parallel()
  * @return True if @p lhs and @p rhs are equivalent, false otherwise.
  */
 bool are_equivalent(const Nfa& lhs, const Nfa& rhs, const Alphabet* alphabet,
@@ -763,13 +945,20 @@ bool are_equivalent(const Nfa& lhs, const Nfa& rhs, const Alphabet* alphabet,
  * @param[in] lhs First automaton to concatenate.
  * @param[in] rhs Second automaton to concatenate.
  * @param[in] params Optional parameters to control the equivalence check algorithm:
- * - "algorithm": "naive", "antichains" (Default: "antichains")
+ * - "algorithm": "naive", "antichains", "antichains-sim" (antichains enhanced with forward simulations, see
+ *      @c algorithms::is_included_antichains_sim()), "hkc" (bisimulation up to congruence, see
+ *      @c algorithms::is_included_hkc()), "hkc-sim" (bisimulation up to congruence and similarity, see
+ *      @c algorithms::is_included_hkc_sim()) (Default: "antichains")
+ * - "macrostate": "sorted-vector", "adaptive" (Default: "sorted-vector"), representation of macrostates of "antichains",
+ *      see @c determinize()
+ * - "threads": number of threads of "antichains" with "sorted-vector" macrostates, "0" for the number of hardware
+ *      threads (Default: "1"), see @c algorithms::is_included_antichains_parallel()
  * @return True if @p lhs and @p rhs are equivalent, false otherwise.
  */
 bool are_equivalent(const Nfa& lhs, const Nfa& rhs, const ParameterMap& params = {{ "algorithm", "antichains"}});
 
-// Reverting the automaton by one of the three functions below,
-// currently simple_revert seems best (however, not tested enough).
+// Reverting the automaton. Builds the reverted transition relation from the index of predecessors
+//  (see Nfa::predecessors()), which is reused when already built. The functions below are alternative algorithms.
 Nfa revert(const Nfa& aut);
 
 // This revert algorithm is fragile, uses low level accesses to Nfa and static data structures,
@@ -788,7 +977,12 @@ Nfa simple_revert(const Nfa& aut);
 //  dense automata, where it is almost as slow as simple_revert. Candidate for removal.
 Nfa somewhat_simple_revert(const Nfa& aut);
 
-// Removing epsilon transitions
+/**
+ * @brief Remove transitions over @p epsilon, adding transitions from the epsilon closures of states instead.
+ *
+ * Epsilon SCCs are collapsed and closures computed once in reverse topological order, see
+ *  @c algorithms::remove_epsilon_transitions().
+ */
 Nfa remove_epsilon(const Nfa& aut, Symbol epsilon = EPSILON);
 
 /** Encodes a vector of strings (each corresponding to one symbol) into a
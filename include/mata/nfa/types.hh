@@ -5,16 +5,39 @@
 
 #include "mata/alphabet.hh"
 #include "mata/parser/parser.hh"
+#include "mata/utils/pool-allocator.hh"
+#include "mata/utils/small-vector.hh"
 
+#include <cstdint>
 #include <limits>
 
 namespace mata::nfa {
 
 extern const std::string TYPE_NFA;
 
+#ifdef MATA_COMPACT_STATES
+/// Compact 32-bit states (enabled by the CMake option `MATA_COMPACT_STATES`), halving the memory needed for targets
+///  of transitions, macrostates and product maps. Automata are then limited to less than 2^32 - 1 states.
+using State = uint32_t;
+#else
 using State = unsigned long;
+#endif
 using StateSet = mata::utils::OrdVector<State>;
 
+#ifdef MATA_POOL_ALLOCATOR
+/// Allocator of the transition relation (symbol posts and targets). Pooled allocation (enabled by the CMake option
+///  `MATA_POOL_ALLOCATOR`) reuses memory freed by temporary automata without calling `malloc` and `free`.
+template<class T> using TransitionAllocator = mata::utils::PoolAllocator<T>;
+#else
+template<class T> using TransitionAllocator = std::allocator<T>;
+#endif
+
+/// Ordered set of targets of a @c SymbolPost. Has the interface of @c StateSet, but stores the few states of most
+///  symbol posts inline (without a heap allocation).
+using TargetSet = mata::utils::OrdVector<
+    State, mata::utils::SmallVector<State, mata::utils::SmallVector<State>::inline_capacity, TransitionAllocator<State>>
+>;
+
 struct Run {
     Word word{}; ///< A finite-length word.
     std::vector<State> path{}; ///< A finite-length path through automaton.
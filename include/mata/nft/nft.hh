@@ -759,7 +759,11 @@ Nft simple_revert(const Nft& aut);
 //  dense automata, where it is almost as slow as simple_revert. Candidate for removal.
 Nft somewhat_simple_revert(const Nft& aut);
 
-// Removing epsilon transitions
+/**
+ * @brief Remove transitions over @p epsilon, adding transitions from the epsilon closures of states instead.
+ *
+ * Works as @c mata::nfa::remove_epsilon(); the levels of states are kept.
+ */
 Nft remove_epsilon(const Nft& aut, Symbol epsilon = EPSILON);
 
 /**
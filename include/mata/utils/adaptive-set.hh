@@ -0,0 +1,325 @@
+/* adaptive-set.hh -- Set of numbers switching between a sorted vector and a bitset by its density.
+ */
+
+#ifndef MATA_ADAPTIVE_SET_HH_
+#define MATA_ADAPTIVE_SET_HH_
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include "ord-vector.hh"
+#include "utils.hh"
+
+namespace mata::utils {
+
+/**
+ * @brief Immutable set of numbers stored either as a sorted vector (sparse form) or as a bitset (dense form).
+ *
+ * The form is chosen by the density of the set: the bitset is used whenever it occupies at most as much memory as
+ *  the sorted vector, that is, when at least one of every @c 8 * sizeof(Number) numbers up to the maximal element is
+ *  in the set. The form depends only on the elements, hence equal sets always have the same form. The hash of the
+ *  set is computed once on construction.
+ *
+ * Inclusion of two dense sets is tested word by word, dense sets are added into an @c AdaptiveSet::Builder by
+ *  word-wise OR. Sets are created from sorted vectors or collected in an @c AdaptiveSet::Builder, which replaces
+ *  merging of sorted vectors by setting bits.
+ *
+ * The set is meant for macrostates of subset constructions, where macrostates are often dense.
+ *
+ * @tparam Number Unsigned integral type of the elements.
+ */
+template<class Number> requires std::is_unsigned_v<Number>
+class AdaptiveSet {
+public:
+    using Word = uint64_t;
+    static constexpr size_t WORD_BITS{ 64 };
+
+    using value_type = Number;
+    using size_type = size_t;
+
+    class const_iterator;
+    using iterator = const_iterator;
+    class Builder;
+
+    AdaptiveSet() = default;
+    explicit AdaptiveSet(const OrdVector<Number>& elements) { assign_sorted(elements.begin(), elements.end()); }
+
+    /// @return Number of elements.
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    /// @return True if the set is stored as a bitset.
+    bool is_dense() const { return dense_; }
+    /// @return Hash of the set, computed on construction.
+    size_t hash() const { return hash_; }
+
+    bool contains(const Number number) const {
+        if (dense_) {
+            const size_t word_index{ number / WORD_BITS };
+            return word_index < words_.size() && (words_[word_index] & bit(number)) != 0;
+        }
+        return std::binary_search(elements_.begin(), elements_.end(), number);
+    }
+
+    /**
+     * Check whether this set is a subset of @p other.
+     */
+    bool is_subset_of(const AdaptiveSet& other) const {
+        if (size_ > other.size_) { return false; }
+        if (dense_ && other.dense_) {
+            // The last word of a dense set is never zero.
+            if (words_.size() > other.words_.size()) { return false; }
+            for (size_t word_index{ 0 }; word_index < words_.size(); ++word_index) {
+                if ((words_[word_index] & ~other.words_[word_index]) != 0) { return false; }
+            }
+            return true;
+        }
+        if (!dense_ && !other.dense_) {
+            if constexpr (set_kernels::Vectorizable<Number>) {
+                return set_kernels::is_subset(elements_.data(), elements_.size(), other.elements_.data(),
+                                              other.elements_.size());
+            } else {
+                return std::includes(other.elements_.begin(), other.elements_.end(), elements_.begin(),
+                                     elements_.end());
+            }
+        }
+        if (other.dense_) {
+            return std::all_of(elements_.begin(), elements_.end(), [&](const Number number) {
+                return other.contains(number);
+            });
+        }
+        return std::includes(other.begin(), other.end(), begin(), end());
+    }
+
+    /**
+     * Check whether any element is contained in @p set, which provides @c contains() (e.g., @c SparseSet).
+     */
+    template<class Set>
+    bool intersects_with(const Set& set) const {
+        return std::any_of(begin(), end(), [&](const Number number) { return set.contains(number); });
+    }
+
+    /// @return The elements as a sorted vector.
+    OrdVector<Number> to_ord_vector() const {
+        OrdVector<Number> result{};
+        result.reserve(size_);
+        for (const Number number: *this) { result.push_back(number); }
+        return result;
+    }
+
+    bool operator==(const AdaptiveSet& other) const {
+        return size_ == other.size_ && hash_ == other.hash_ && dense_ == other.dense_
+               && elements_ == other.elements_ && words_ == other.words_;
+    }
+
+    /// Lexicographic order of the sorted elements.
+    std::strong_ordering operator<=>(const AdaptiveSet& other) const {
+        return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+    }
+
+    const_iterator begin() const { return const_iterator{ *this, 0 }; }
+    const_iterator end() const { return const_iterator{ *this, dense_ ? words_.size() : elements_.size() }; }
+
+    /**
+     * @brief Forward iterator over the elements in the ascending order.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Number;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Number*;
+        using reference = Number;
+
+        const_iterator() = default;
+
+        Number operator*() const { return current_; }
+
+        const_iterator& operator++() {
+            if (set_->dense_) {
+                word_ &= word_ - 1;
+                settle_dense();
+            } else if (++position_ < set_->elements_.size()) {
+                current_ = set_->elements_[position_];
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const const_iterator tmp{ *this };
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return position_ == other.position_ && word_ == other.word_;
+        }
+
+    private:
+        friend class AdaptiveSet;
+
+        const AdaptiveSet* set_{ nullptr };
+        /// Index of the current element (sparse form) or of the current word (dense form).
+        size_t position_{ 0 };
+        /// Not yet visited bits of the current word, including the current element (dense form).
+        Word word_{ 0 };
+        Number current_{};
+
+        const_iterator(const AdaptiveSet& set, const size_t position) : set_{ &set }, position_{ position } {
+            if (set.dense_) {
+                if (position_ < set.words_.size()) { word_ = set.words_[position_]; }
+                settle_dense();
+            } else if (position_ < set.elements_.size()) {
+                current_ = set.elements_[position_];
+            }
+        }
+
+        /// Move to the lowest not yet visited bit, skipping zero words.
+        void settle_dense() {
+            const std::vector<Word>& words{ set_->words_ };
+            while (word_ == 0 && position_ < words.size()) {
+                ++position_;
+                if (position_ < words.size()) { word_ = words[position_]; }
+            }
+            if (word_ != 0) {
+                current_ = static_cast<Number>(position_ * WORD_BITS + static_cast<size_t>(std::countr_zero(word_)));
+            }
+        }
+    }; // class const_iterator.
+
+    /**
+     * @brief Collects a union of numbers and sets into a bitset and creates an @c AdaptiveSet of it.
+     *
+     * Only the words touched since the last @c build() are visited when creating the set and clearing the builder,
+     *  so a single builder over the whole universe is reused for all sets of a subset construction.
+     */
+    class Builder {
+    public:
+        /**
+         * @param[in] universe_size Numbers smaller than @p universe_size are inserted without growing the bitset.
+         */
+        explicit Builder(const size_t universe_size = 0) : words_(num_of_words(universe_size), 0) {}
+
+        void insert(const Number number) {
+            const size_t word_index{ number / WORD_BITS };
+            if (word_index >= words_.size()) { words_.resize(word_index + 1, 0); }
+            Word& word{ words_[word_index] };
+            if (word == 0) { touched_.push_back(word_index); }
+            word |= bit(number);
+        }
+
+        template<std::ranges::range Range>
+        void insert(const Range& numbers) { for (const Number number: numbers) { insert(number); } }
+
+        void insert(const AdaptiveSet& set) {
+            if (!set.dense_) { return insert(set.elements_); }
+            if (set.words_.size() > words_.size()) { words_.resize(set.words_.size(), 0); }
+            for (size_t word_index{ 0 }; word_index < set.words_.size(); ++word_index) {
+                const Word set_word{ set.words_[word_index] };
+                if (set_word == 0) { continue; }
+                if (words_[word_index] == 0) { touched_.push_back(word_index); }
+                words_[word_index] |= set_word;
+            }
+        }
+
+        bool empty() const { return touched_.empty(); }
+
+        /**
+         * Create a set of the inserted numbers and clear the builder.
+         */
+        AdaptiveSet build() {
+            AdaptiveSet set{};
+            if (touched_.empty()) { return set; }
+            std::sort(touched_.begin(), touched_.end());
+            for (const size_t word_index: touched_) {
+                set.size_ += static_cast<size_t>(std::popcount(words_[word_index]));
+            }
+            const size_t last_word_index{ touched_.back() };
+            const size_t max{ last_word_index * WORD_BITS + WORD_BITS - 1
+                              - static_cast<size_t>(std::countl_zero(words_[last_word_index])) };
+            set.dense_ = prefers_dense(set.size_, max);
+            if (set.dense_) {
+                set.words_.resize(last_word_index + 1, 0);
+                for (const size_t word_index: touched_) {
+                    set.words_[word_index] = words_[word_index];
+                    words_[word_index] = 0;
+                }
+            } else {
+                set.elements_.reserve(set.size_);
+                for (const size_t word_index: touched_) {
+                    for (Word word{ words_[word_index] }; word != 0; word &= word - 1) {
+                        set.elements_.push_back(static_cast<Number>(
+                            word_index * WORD_BITS + static_cast<size_t>(std::countr_zero(word))));
+                    }
+                    words_[word_index] = 0;
+                }
+            }
+            touched_.clear();
+            set.compute_hash();
+            return set;
+        }
+
+        /// Remove all inserted numbers.
+        void clear() {
+            for (const size_t word_index: touched_) { words_[word_index] = 0; }
+            touched_.clear();
+        }
+
+    private:
+        std::vector<Word> words_; ///< Bitset of the inserted numbers.
+        std::vector<size_t> touched_{}; ///< Indices of non-zero words of @c words_.
+    }; // class Builder.
+
+private:
+    bool dense_{ false };
+    size_t size_{ 0 };
+    size_t hash_{ 0 };
+    std::vector<Number> elements_{}; ///< Sorted elements of the sparse form.
+    std::vector<Word> words_{}; ///< Bitset of the dense form, without trailing zero words.
+
+    static constexpr Word bit(const Number number) { return Word{ 1 } << (number % WORD_BITS); }
+    static constexpr size_t num_of_words(const size_t universe_size) {
+        return (universe_size + WORD_BITS - 1) / WORD_BITS;
+    }
+    /// Whether a bitset up to @p max occupies at most as much memory as a vector of @p size elements.
+    static constexpr bool prefers_dense(const size_t size, const size_t max) {
+        return (max / WORD_BITS + 1) * sizeof(Word) <= size * sizeof(Number);
+    }
+
+    template<class Iterator>
+    void assign_sorted(Iterator first, const Iterator last) {
+        size_ = static_cast<size_t>(std::distance(first, last));
+        if (size_ == 0) { return; }
+        dense_ = prefers_dense(size_, static_cast<size_t>(*std::prev(last)));
+        if (dense_) {
+            words_.resize(static_cast<size_t>(*std::prev(last)) / WORD_BITS + 1, 0);
+            for (; first != last; ++first) { words_[*first / WORD_BITS] |= bit(*first); }
+        } else {
+            elements_.assign(first, last);
+        }
+        compute_hash();
+    }
+
+    void compute_hash() {
+        hash_ = dense_ ? hash_range(words_.begin(), words_.end()) : hash_range(elements_.begin(), elements_.end());
+    }
+}; // class AdaptiveSet.
+
+} // namespace mata::utils.
+
+namespace std {
+template<class Number>
+struct hash<mata::utils::AdaptiveSet<Number>> {
+    size_t operator()(const mata::utils::AdaptiveSet<Number>& set) const { return set.hash(); }
+};
+} // namespace std.
+
+#endif // MATA_ADAPTIVE_SET_HH_
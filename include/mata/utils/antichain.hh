@@ -0,0 +1,138 @@
+/* antichain.hh -- Antichain of sets with fast subsumption checks.
+ */
+
+#ifndef MATA_ANTICHAIN_HH_
+#define MATA_ANTICHAIN_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace mata::utils {
+
+/**
+ * @brief Antichain of sets with respect to inclusion, as used by antichain algorithms over macrostates.
+ *
+ * Each element is a set with an identifier given by the user (e.g., an index of a node in the search, which keeps
+ *  parent links for counterexamples). Elements are kept in buckets by their cardinality, so that looking for subsets
+ *  (supersets) of a set visits only buckets with smaller (bigger) sets. Each element has a 64-bit signature with the
+ *  bit @c element % 64 set for each of its elements, which rejects most non-subsets before comparing the sets.
+ *
+ * The antichain property is maintained by the user: @c contains_subset_of() is checked before inserting a set, and its
+ *  supersets are removed by @c erase_supersets_of(). Relations other than inclusion (e.g., inclusion up to simulation)
+ *  are supported by @c any_of() and @c erase_if(), which visit all elements.
+ *
+ * @tparam Set Set type iterable over unsigned numbers with @c size() and @c is_subset_of() (@c OrdVector or
+ *  @c AdaptiveSet).
+ * @tparam Id Type of identifiers of elements.
+ */
+template<class Set, class Id = size_t>
+class Antichain {
+public:
+    /// Number of elements.
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * Is there an element which is a subset of @p set (including @p set itself)?
+     */
+    bool contains_subset_of(const Set& set) const {
+        const uint64_t set_signature{ signature(set) };
+        const size_t max_size{ std::min(set.size() + 1, buckets_.size()) };
+        for (size_t size{ 0 }; size < max_size; ++size) {
+            for (const Element& element: buckets_[size]) {
+                if ((element.signature & ~set_signature) == 0 && element.set.is_subset_of(set)) { return true; }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Remove elements which are supersets of @p set (including @p set itself).
+     * @param[in] on_erased Called with the identifier of each removed element.
+     */
+    template<class OnErased>
+    void erase_supersets_of(const Set& set, OnErased on_erased) {
+        const uint64_t set_signature{ signature(set) };
+        for (size_t size{ set.size() }; size < buckets_.size(); ++size) {
+            erase_from_bucket(buckets_[size], [&](const Element& element) {
+                return (set_signature & ~element.signature) == 0 && set.is_subset_of(element.set);
+            }, on_erased);
+        }
+    }
+
+    /**
+     * Insert @p set with the identifier @p id. The set is not checked against the other elements.
+     */
+    void insert(Set set, Id id) {
+        const size_t size{ set.size() };
+        if (buckets_.size() <= size) { buckets_.resize(size + 1); }
+        const uint64_t set_signature{ signature(set) };
+        buckets_[size].push_back({ std::move(set), set_signature, std::move(id) });
+        ++size_;
+    }
+
+    /**
+     * Does @p predicate hold for some element?
+     * @param[in] predicate Called with the set and the identifier of elements.
+     */
+    template<class Predicate>
+    bool any_of(Predicate predicate) const {
+        for (const std::vector<Element>& bucket: buckets_) {
+            for (const Element& element: bucket) {
+                if (predicate(element.set, element.id)) { return true; }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Remove elements for which @p predicate holds.
+     * @param[in] predicate Called with the set and the identifier of elements.
+     * @param[in] on_erased Called with the identifier of each removed element.
+     */
+    template<class Predicate, class OnErased>
+    void erase_if(Predicate predicate, OnErased on_erased) {
+        for (std::vector<Element>& bucket: buckets_) {
+            erase_from_bucket(bucket, [&](const Element& element) { return predicate(element.set, element.id); },
+                              on_erased);
+        }
+    }
+
+private:
+    struct Element {
+        Set set;
+        uint64_t signature;
+        Id id;
+    };
+
+    std::vector<std::vector<Element>> buckets_{}; ///< Elements by their cardinality.
+    size_t size_{ 0 };
+
+    static uint64_t signature(const Set& set) {
+        uint64_t result{ 0 };
+        for (const auto number: set) { result |= uint64_t{ 1 } << (number % 64); }
+        return result;
+    }
+
+    template<class Predicate, class OnErased>
+    void erase_from_bucket(std::vector<Element>& bucket, Predicate predicate, OnErased& on_erased) {
+        for (size_t i{ 0 }; i < bucket.size();) {
+            if (predicate(bucket[i])) {
+                on_erased(bucket[i].id);
+                // The order of elements in a bucket does not matter.
+                if (i + 1 != bucket.size()) { bucket[i] = std::move(bucket.back()); }
+                bucket.pop_back();
+                --size_;
+            } else {
+                ++i;
+            }
+        }
+    }
+};
+
+} // namespace mata::utils
+
+#endif // MATA_ANTICHAIN_HH_
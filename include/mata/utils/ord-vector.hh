@@ -6,7 +6,16 @@
 
 #include <vector>
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATA_SET_KERNELS_X86 1
+#include <immintrin.h>
+#endif
 
 #include "utils.hh"
 
@@ -35,22 +44,10 @@ std::string to_str(const T& n) {
 
 namespace mata::utils {
 
-template <class Key> class OrdVector;
-
-template <class T>
-bool are_disjoint(const utils::OrdVector<T>& lhs, const utils::OrdVector<T>& rhs) {
-    auto itLhs = lhs.begin();
-    auto itRhs = rhs.begin();
-    while (itLhs != lhs.end() && itRhs != rhs.end()) {
-        if (*itLhs == *itRhs) { return false; }
-        else if (*itLhs < *itRhs) { ++itLhs; }
-        else {++itRhs; }
-    }
-    return true;
-}
+template <class Key, class Container> class OrdVector;
 
-template <class Key>
-bool is_sorted(const std::vector<Key>& vec) {
+template <class Vector>
+bool is_sorted(const Vector& vec) {
     for (auto itVec = vec.cbegin() + 1; itVec < vec.cend(); ++itVec) {
         if (!(*(itVec - 1) < *itVec)) {
             // In case there is an unordered pair (or there is one element twice).
@@ -60,6 +57,402 @@ bool is_sorted(const std::vector<Key>& vec) {
     return true;
 }
 
+/**
+ * Kernels of set operations on sorted arrays of distinct integers (the representation of @c OrdVector).
+ *
+ * Intersection, intersection test and inclusion test have vectorized implementations which compare a block of
+ *  elements of the first array with a block of elements of the second array all-pairs (the second block is rotated
+ *  through all lanes) and then skip the block with the smaller maximum, as in "Fast Sorted-Set Intersection using SIMD
+ *  Instructions" by Schlegel, Willhalm and Lehner. The instruction set is selected at runtime (AVX2, then SSE4.2,
+ *  then the scalar merge), so the library does not need to be compiled with @c -mavx2. Union has no vectorized
+ *  kernel: merging cannot skip blocks, and neither a vectorized nor a branch-free scalar merge beats
+ *  @c std::set_union on the sets occurring in automata.
+ *
+ * All kernels expect both arrays to be sorted and without duplicates.
+ */
+namespace set_kernels {
+
+/// Instruction set used by the kernels.
+enum class Isa {
+    Scalar, ///< Plain merge loops.
+    Sse42, ///< 128-bit vectors.
+    Avx2, ///< 256-bit vectors.
+};
+
+/// Element types supported by the vectorized kernels.
+template<class T>
+concept Vectorizable = std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+/**
+ * Check whether the running CPU supports @p isa.
+ */
+inline bool is_supported(const Isa isa) {
+#ifdef MATA_SET_KERNELS_X86
+    switch (isa) {
+        case Isa::Avx2: return __builtin_cpu_supports("avx2");
+        case Isa::Sse42: return __builtin_cpu_supports("sse4.2");
+        case Isa::Scalar: return true;
+    }
+    return false;
+#else
+    return isa == Isa::Scalar;
+#endif
+}
+
+/**
+ * The best instruction set supported by the running CPU (detected once).
+ */
+inline Isa best_isa() {
+    static const Isa isa{ is_supported(Isa::Avx2) ? Isa::Avx2 : (is_supported(Isa::Sse42) ? Isa::Sse42 : Isa::Scalar) };
+    return isa;
+}
+
+namespace internal {
+
+template<class T>
+bool intersects_scalar(const T* lhs, const size_t lhs_size, const T* rhs, const size_t rhs_size) {
+    size_t i{ 0 }, j{ 0 };
+    while (i < lhs_size && j < rhs_size) {
+        if (lhs[i] == rhs[j]) { return true; }
+        if (lhs[i] < rhs[j]) { ++i; } else { ++j; }
+    }
+    return false;
+}
+
+template<class T>
+size_t intersection_scalar(const T* lhs, const size_t lhs_size, const T* rhs, const size_t rhs_size, T* out) {
+    size_t i{ 0 }, j{ 0 }, k{ 0 };
+    while (i < lhs_size && j < rhs_size) {
+        if (lhs[i] == rhs[j]) {
+            out[k++] = lhs[i];
+            ++i;
+            ++j;
+        } else if (lhs[i] < rhs[j]) { ++i; } else { ++j; }
+    }
+    return k;
+}
+
+template<class T>
+bool is_subset_scalar(const T* smaller, const size_t smaller_size, const T* bigger, const size_t bigger_size) {
+    return std::includes(bigger, bigger + bigger_size, smaller, smaller + smaller_size);
+}
+
+/*
+ * The generic block drivers below are instantiated with a kernel providing @c block_size and
+ *  @c match_mask(lhs, rhs): a bit mask of lanes of the block at @p lhs equal to some element of the block at @p rhs.
+ *  After advancing past a block of @p lhs, its elements cannot occur in the rest of @p rhs (and vice versa), hence each
+ *  pair of blocks which may share an element is compared exactly once. The remainders shorter than a block are merged
+ *  by the scalar loops.
+ */
+
+template<class Kernel, class T>
+bool intersects_blocks(const T* lhs, const size_t lhs_size, const T* rhs, const size_t rhs_size) {
+    constexpr size_t B{ Kernel::block_size };
+    size_t i{ 0 }, j{ 0 };
+    while (i + B <= lhs_size && j + B <= rhs_size) {
+        if (Kernel::match_mask(lhs + i, rhs + j) != 0) { return true; }
+        const T lhs_max{ lhs[i + B - 1] };
+        const T rhs_max{ rhs[j + B - 1] };
+        i += (lhs_max <= rhs_max) * B;
+        j += (rhs_max <= lhs_max) * B;
+    }
+    return intersects_scalar(lhs + i, lhs_size - i, rhs + j, rhs_size - j);
+}
+
+template<class Kernel, class T>
+size_t intersection_blocks(const T* lhs, const size_t lhs_size, const T* rhs, const size_t rhs_size, T* out) {
+    constexpr size_t B{ Kernel::block_size };
+    const size_t out_capacity{ std::min(lhs_size, rhs_size) };
+    size_t i{ 0 }, j{ 0 }, k{ 0 };
+    // Lanes of the current block of lhs matched by the blocks of rhs seen so far.
+    unsigned matched{ 0 };
+    auto flush_matched = [&]() {
+        // The kernel stores the whole block (matched lanes first), so it needs room for a whole block.
+        if (k + B <= out_capacity) {
+            k += Kernel::store_matched(lhs + i, matched, out + k);
+        } else {
+            for (; matched != 0; matched &= matched - 1) { out[k++] = lhs[i + static_cast<size_t>(__builtin_ctz(matched))]; }
+        }
+        matched = 0;
+    };
+    while (i + B <= lhs_size && j + B <= rhs_size) {
+        matched |= Kernel::match_mask(lhs + i, rhs + j);
+        const T lhs_max{ lhs[i + B - 1] };
+        const T rhs_max{ rhs[j + B - 1] };
+        if (lhs_max <= rhs_max) {
+            flush_matched();
+            i += B;
+        }
+        j += (rhs_max <= lhs_max) * B;
+    }
+    // The matched elements are smaller than rhs[j], so they precede whatever the scalar merge finds.
+    flush_matched();
+    return k + intersection_scalar(lhs + i, lhs_size - i, rhs + j, rhs_size - j, out + k);
+}
+
+template<class Kernel, class T>
+bool is_subset_blocks(const T* smaller, const size_t smaller_size, const T* bigger, const size_t bigger_size) {
+    constexpr size_t B{ Kernel::block_size };
+    constexpr unsigned all_matched{ (1u << B) - 1 };
+    size_t i{ 0 }, j{ 0 };
+    unsigned matched{ 0 };
+    while (i + B <= smaller_size && j + B <= bigger_size) {
+        matched |= Kernel::match_mask(smaller + i, bigger + j);
+        const T smaller_max{ smaller[i + B - 1] };
+        const T bigger_max{ bigger[j + B - 1] };
+        if (smaller_max <= bigger_max) {
+            if (matched != all_matched) { return false; }
+            matched = 0;
+            i += B;
+        }
+        j += (bigger_max <= smaller_max) * B;
+    }
+    // Lanes of the current block which were not matched yet and the remainder of smaller must be found in the rest of
+    //  bigger.
+    for (size_t s{ i }; s < smaller_size; ++s) {
+        if (s < i + B && (matched >> (s - i)) & 1) { continue; }
+        while (j < bigger_size && bigger[j] < smaller[s]) { ++j; }
+        if (j == bigger_size || bigger[j] != smaller[s]) { return false; }
+        ++j;
+    }
+    return true;
+}
+
+#ifdef MATA_SET_KERNELS_X86
+/**
+ * Shuffle indices moving the lanes selected by a mask of @p Lanes lanes to the front, for each mask. Each lane consists
+ *  of @p Width units of the shuffle instruction (e.g., a 32-bit lane shuffled by bytes has 4 units).
+ */
+template<size_t Lanes, size_t Width>
+inline constexpr auto compress_indices{ [] {
+    std::array<std::array<uint8_t, Lanes * Width>, size_t{ 1 } << Lanes> table{};
+    for (size_t mask{ 0 }; mask < table.size(); ++mask) {
+        size_t unit_index{ 0 };
+        for (size_t lane{ 0 }; lane < Lanes; ++lane) {
+            if (((mask >> lane) & 1) == 0) { continue; }
+            for (size_t unit{ 0 }; unit < Width; ++unit) {
+                table[mask][unit_index++] = static_cast<uint8_t>(lane * Width + unit);
+            }
+        }
+    }
+    return table;
+}() };
+
+template<size_t ElementSize> struct Sse42Kernel;
+
+template<> struct Sse42Kernel<4> {
+    static constexpr size_t block_size{ 4 };
+    template<class T>
+    __attribute__((target("sse4.2"))) static unsigned match_mask(const T* lhs, const T* rhs) {
+        const __m128i l{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs)) };
+        __m128i r{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs)) };
+        __m128i eq{ _mm_cmpeq_epi32(l, r) };
+        for (int rotation{ 1 }; rotation < 4; ++rotation) {
+            r = _mm_shuffle_epi32(r, _MM_SHUFFLE(0, 3, 2, 1));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi32(l, r));
+        }
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+    }
+
+    template<class T>
+    __attribute__((target("sse4.2"))) static size_t store_matched(const T* block, const unsigned mask, T* out) {
+        const __m128i indices{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(compress_indices<4, 4>[mask].data())) };
+        const __m128i values{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(block)) };
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(values, indices));
+        return static_cast<size_t>(__builtin_popcount(mask));
+    }
+};
+
+template<> struct Sse42Kernel<8> {
+    static constexpr size_t block_size{ 2 };
+    template<class T>
+    __attribute__((target("sse4.2"))) static unsigned match_mask(const T* lhs, const T* rhs) {
+        const __m128i l{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs)) };
+        const __m128i r{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs)) };
+        const __m128i eq{ _mm_or_si128(_mm_cmpeq_epi64(l, r),
+                                       _mm_cmpeq_epi64(l, _mm_shuffle_epi32(r, _MM_SHUFFLE(1, 0, 3, 2)))) };
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(eq)));
+    }
+
+    template<class T>
+    static size_t store_matched(const T* block, const unsigned mask, T* out) {
+        out[0] = block[mask == 2];
+        out[1] = block[1];
+        return static_cast<size_t>(__builtin_popcount(mask));
+    }
+};
+
+template<size_t ElementSize> struct Avx2Kernel;
+
+template<> struct Avx2Kernel<4> {
+    static constexpr size_t block_size{ 8 };
+    template<class T>
+    __attribute__((target("avx2"))) static unsigned match_mask(const T* lhs, const T* rhs) {
+        const __m256i l{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs)) };
+        __m256i r{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs)) };
+        const __m256i rotate{ _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0) };
+        __m256i eq{ _mm256_cmpeq_epi32(l, r) };
+        for (int rotation{ 1 }; rotation < 8; ++rotation) {
+            r = _mm256_permutevar8x32_epi32(r, rotate);
+            eq = _mm256_or_si256(eq, _mm256_cmpeq_epi32(l, r));
+        }
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+    }
+
+    template<class T>
+    __attribute__((target("avx2"))) static size_t store_matched(const T* block, const unsigned mask, T* out) {
+        const __m256i indices{ _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(compress_indices<8, 1>[mask].data()))) };
+        const __m256i values{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)) };
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permutevar8x32_epi32(values, indices));
+        return static_cast<size_t>(__builtin_popcount(mask));
+    }
+};
+
+template<> struct Avx2Kernel<8> {
+    static constexpr size_t block_size{ 4 };
+    template<class T>
+    __attribute__((target("avx2"))) static unsigned match_mask(const T* lhs, const T* rhs) {
+        const __m256i l{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs)) };
+        __m256i r{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs)) };
+        __m256i eq{ _mm256_cmpeq_epi64(l, r) };
+        for (int rotation{ 1 }; rotation < 4; ++rotation) {
+            r = _mm256_permute4x64_epi64(r, _MM_SHUFFLE(0, 3, 2, 1));
+            eq = _mm256_or_si256(eq, _mm256_cmpeq_epi64(l, r));
+        }
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(eq)));
+    }
+
+    template<class T>
+    __attribute__((target("avx2"))) static size_t store_matched(const T* block, const unsigned mask, T* out) {
+        // 64-bit lanes are moved as pairs of 32-bit lanes.
+        const __m256i indices{ _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(compress_indices<4, 2>[mask].data()))) };
+        const __m256i values{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block)) };
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permutevar8x32_epi32(values, indices));
+        return static_cast<size_t>(__builtin_popcount(mask));
+    }
+};
+
+// Entry points compiled for the particular instruction set. Flattening inlines the generic drivers together with the
+//  kernel into them, so that the whole loop uses the vector instructions.
+template<class T>
+__attribute__((target("sse4.2"), flatten))
+bool intersects_sse42(const T* lhs, size_t lhs_size, const T* rhs, size_t rhs_size) {
+    return intersects_blocks<Sse42Kernel<sizeof(T)>>(lhs, lhs_size, rhs, rhs_size);
+}
+
+template<class T>
+__attribute__((target("avx2"), flatten))
+bool intersects_avx2(const T* lhs, size_t lhs_size, const T* rhs, size_t rhs_size) {
+    return intersects_blocks<Avx2Kernel<sizeof(T)>>(lhs, lhs_size, rhs, rhs_size);
+}
+
+template<class T>
+__attribute__((target("sse4.2"), flatten))
+size_t intersection_sse42(const T* lhs, size_t lhs_size, const T* rhs, size_t rhs_size, T* out) {
+    return intersection_blocks<Sse42Kernel<sizeof(T)>>(lhs, lhs_size, rhs, rhs_size, out);
+}
+
+template<class T>
+__attribute__((target("avx2"), flatten))
+size_t intersection_avx2(const T* lhs, size_t lhs_size, const T* rhs, size_t rhs_size, T* out) {
+    return intersection_blocks<Avx2Kernel<sizeof(T)>>(lhs, lhs_size, rhs, rhs_size, out);
+}
+
+template<class T>
+__attribute__((target("sse4.2"), flatten))
+bool is_subset_sse42(const T* smaller, size_t smaller_size, const T* bigger, size_t bigger_size) {
+    return is_subset_blocks<Sse42Kernel<sizeof(T)>>(smaller, smaller_size, bigger, bigger_size);
+}
+
+template<class T>
+__attribute__((target("avx2"), flatten))
+bool is_subset_avx2(const T* smaller, size_t smaller_size, const T* bigger, size_t bigger_size) {
+    return is_subset_blocks<Avx2Kernel<sizeof(T)>>(smaller, smaller_size, bigger, bigger_size);
+}
+#endif // MATA_SET_KERNELS_X86.
+
+} // namespace internal.
+
+/**
+ * Check whether the sorted arrays @p lhs and @p rhs have a common element.
+ * @param[in] isa Instruction set to use; it has to be supported by the running CPU.
+ */
+template<Vectorizable T>
+bool intersects(const T* lhs, const size_t lhs_size, const T* rhs, const size_t rhs_size,
+                const Isa isa = best_isa()) {
+#ifdef MATA_SET_KERNELS_X86
+    switch (isa) {
+        case Isa::Avx2: return internal::intersects_avx2(lhs, lhs_size, rhs, rhs_size);
+        case Isa::Sse42: return internal::intersects_sse42(lhs, lhs_size, rhs, rhs_size);
+        case Isa::Scalar: break;
+    }
+#else
+    (void)isa;
+#endif
+    return internal::intersects_scalar(lhs, lhs_size, rhs, rhs_size);
+}
+
+/**
+ * Write the intersection of the sorted arrays @p lhs and @p rhs to @p out.
+ * @param[out] out Array for the result with room for at least min(@p lhs_size, @p rhs_size) elements.
+ * @param[in] isa Instruction set to use; it has to be supported by the running CPU.
+ * @return Number of elements written to @p out.
+ */
+template<Vectorizable T>
+size_t intersection(const T* lhs, const size_t lhs_size, const T* rhs, const size_t rhs_size, T* out,
+                    const Isa isa = best_isa()) {
+#ifdef MATA_SET_KERNELS_X86
+    switch (isa) {
+        case Isa::Avx2: return internal::intersection_avx2(lhs, lhs_size, rhs, rhs_size, out);
+        case Isa::Sse42: return internal::intersection_sse42(lhs, lhs_size, rhs, rhs_size, out);
+        case Isa::Scalar: break;
+    }
+#else
+    (void)isa;
+#endif
+    return internal::intersection_scalar(lhs, lhs_size, rhs, rhs_size, out);
+}
+
+/**
+ * Check whether every element of the sorted array @p smaller occurs in the sorted array @p bigger.
+ * @param[in] isa Instruction set to use; it has to be supported by the running CPU.
+ */
+template<Vectorizable T>
+bool is_subset(const T* smaller, const size_t smaller_size, const T* bigger, const size_t bigger_size,
+               const Isa isa = best_isa()) {
+    if (smaller_size > bigger_size) { return false; }
+#ifdef MATA_SET_KERNELS_X86
+    switch (isa) {
+        case Isa::Avx2: return internal::is_subset_avx2(smaller, smaller_size, bigger, bigger_size);
+        case Isa::Sse42: return internal::is_subset_sse42(smaller, smaller_size, bigger, bigger_size);
+        case Isa::Scalar: break;
+    }
+#else
+    (void)isa;
+#endif
+    return internal::is_subset_scalar(smaller, smaller_size, bigger, bigger_size);
+}
+
+} // namespace set_kernels.
+
+template <class T, class LhsContainer, class RhsContainer>
+bool are_disjoint(const utils::OrdVector<T, LhsContainer>& lhs, const utils::OrdVector<T, RhsContainer>& rhs) {
+    if constexpr (set_kernels::Vectorizable<T>) {
+        return !set_kernels::intersects(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    } else {
+        auto itLhs = lhs.begin();
+        auto itRhs = rhs.begin();
+        while (itLhs != lhs.end() && itRhs != rhs.end()) {
+            if (*itLhs == *itRhs) { return false; }
+            else if (*itLhs < *itRhs) { ++itLhs; }
+            else {++itRhs; }
+        }
+        return true;
+    }
+}
+
 /**
  * @brief  Implementation of a set using ordered vector
  *
@@ -68,12 +461,15 @@ bool is_sorted(const std::vector<Key>& vec) {
  *
  * @tparam  Key  Key type: type of the elements contained in the container.
  *               Each elements in a set is also its key.
+ * @tparam  Container  Underlying vector type (@c std::vector or a vector with the same interface, such as
+ *                     @c SmallVector).
  */
-template<class Key> class OrdVector {
+template<class Key, class Container = std::vector<Key>> class OrdVector {
 private:  // Private data types
+    template<class OtherKey, class OtherContainer> friend class OrdVector;
 
 public:   // Public data types
-    using VectorType = std::vector<Key>;
+    using VectorType = Container;
     using value_type = Key;
     using size_type = size_t;
     using iterator = typename VectorType::iterator ;
@@ -96,6 +492,9 @@ public:
     OrdVector(std::initializer_list<Key> list) : vec_(list) { utils::sort_and_rmdupl(vec_); }
     OrdVector(const OrdVector& rhs) = default;
     OrdVector(OrdVector&& other) noexcept : vec_{ std::move(other.vec_) } {}
+    /// Convert an ordered vector with a different underlying vector type (the elements are already ordered).
+    template <class OtherContainer> requires (!std::is_same_v<OtherContainer, Container>)
+    OrdVector(const OrdVector<Key, OtherContainer>& other) : vec_(other.cbegin(), other.cend()) {}
     explicit OrdVector(const Key& key) : vec_(1, key) { assert(is_sorted()); }
     template <class InputIterator>
     explicit OrdVector(InputIterator first, InputIterator last) : vec_(first, last) { utils::sort_and_rmdupl(vec_); }
@@ -110,7 +509,7 @@ public:
         return *this;
     }
 
-    virtual ~OrdVector() = default;
+    ~OrdVector() = default;
 
     /**
      * Create OrdVector with reserved @p capacity.
@@ -147,13 +546,13 @@ public:
     // but useful in NFA where temporarily breaking the sortedness invariant allows for a faster algorithm (e.g. revert)
     reference push_back(Key&& t) { return emplace_back(std::move(t)); }
 
-    virtual inline void reserve(size_t size) { vec_.reserve(size); }
-    virtual inline void resize(size_t size) { vec_.resize(size); }
+    inline void reserve(size_t size) { vec_.reserve(size); }
+    inline void resize(size_t size) { vec_.resize(size); }
 
-    virtual inline iterator erase(const_iterator pos) { return vec_.erase(pos); }
-    virtual inline iterator erase(const_iterator first, const_iterator last) { return vec_.erase(first, last); }
+    inline iterator erase(const_iterator pos) { return vec_.erase(pos); }
+    inline iterator erase(const_iterator first, const_iterator last) { return vec_.erase(first, last); }
 
-    virtual void insert(const Key& x) {
+    void insert(const Key& x) {
         assert(is_sorted());
 
         reserve_on_insert(vec_);
@@ -200,7 +599,7 @@ public:
         assert(is_sorted());
     }
 
-    virtual void insert(const OrdVector& vec) {
+    void insert(const OrdVector& vec) {
         static OrdVector tmp{};
         assert(is_sorted());
         assert(vec.is_sorted());
@@ -218,9 +617,23 @@ public:
         assert(is_sorted());
     }
 
+    template <class OtherContainer> requires (!std::is_same_v<OtherContainer, Container>)
+    void insert(const OrdVector<Key, OtherContainer>& vec) {
+        assert(is_sorted());
+        assert(vec.is_sorted());
+        if (vec.empty()) { return; }
+        if (vec.size() == 1) { insert(vec.front()); return; }
+
+        OrdVector result{};
+        result.reserve(size() + vec.size());
+        std::set_union(vec_.begin(), vec_.end(), vec.cbegin(), vec.cend(), std::back_inserter(result.vec_));
+        *this = std::move(result);
+        assert(is_sorted());
+    }
+
     inline void clear() { vec_.clear(); }
 
-    virtual inline size_t size() const { return vec_.size(); }
+    inline size_t size() const { return vec_.size(); }
 
     inline size_t count(const Key& key) const {
         assert(is_sorted());
@@ -242,7 +655,7 @@ public:
 
     OrdVector intersection(const OrdVector& rhs) const { return intersection(*this, rhs); }
 
-    virtual const_iterator find(const Key& key) const {
+    const_iterator find(const Key& key) const {
         assert(is_sorted());
 
         auto it = std::lower_bound(vec_.begin(), vec_.end(),key);
@@ -252,7 +665,7 @@ public:
             return it;
     }
 
-    virtual iterator find(const Key& key) {
+    iterator find(const Key& key) {
         assert(is_sorted());
 
         auto it = std::lower_bound(vec_.begin(), vec_.end(),key);
@@ -262,8 +675,8 @@ public:
             return it;
     }
 
-    virtual const Key& front() const { return vec_[0]; }
-    virtual Key& front() { return vec_[0]; }
+    const Key& front() const { return vec_[0]; }
+    Key& front() { return vec_[0]; }
 
     /**
      * Check whether @p key exists in the ordered vector.
@@ -289,7 +702,7 @@ public:
         return 0;
     }
 
-    virtual inline bool empty() const { return vec_.empty(); }
+    inline bool empty() const { return vec_.empty(); }
 
     // Indexes which ar staying are shifted left to take place of those that are not staying.
     template<typename Fun>
@@ -303,25 +716,25 @@ public:
         utils::filter(vec_, is_staying);
     }
 
-    virtual inline const_reference back() const { return vec_.back(); }
+    inline const_reference back() const { return vec_.back(); }
 
     /**
      * @brief Get reference to the last element in the vector.
      *
      * Modifying the underlying value in the reference could break sortedness.
      */
-    virtual inline reference back() { return vec_.back(); }
+    inline reference back() { return vec_.back(); }
 
-    virtual inline void pop_back() { return vec_.pop_back(); }
+    inline void pop_back() { return vec_.pop_back(); }
 
-    virtual inline const_iterator begin() const { return vec_.begin(); }
-    virtual inline const_iterator end() const { return vec_.end(); }
+    inline const_iterator begin() const { return vec_.begin(); }
+    inline const_iterator end() const { return vec_.end(); }
 
-    virtual inline iterator begin() { return vec_.begin(); }
-    virtual inline iterator end() { return vec_.end(); }
+    inline iterator begin() { return vec_.begin(); }
+    inline iterator end() { return vec_.end(); }
 
-	virtual inline const_iterator cbegin() const { return begin(); }
-	virtual inline const_iterator cend() const { return end(); }
+	inline const_iterator cbegin() const { return begin(); }
+	inline const_iterator cend() const { return end(); }
 
 	/**
 	 * @brief  Overloaded << operator
@@ -351,22 +764,39 @@ public:
 		return (vec_ == rhs.vec_);
 	}
 
+    template <class OtherContainer> requires (!std::is_same_v<OtherContainer, Container>)
+    bool operator==(const OrdVector<Key, OtherContainer>& rhs) const {
+        return std::equal(cbegin(), cend(), rhs.cbegin(), rhs.cend());
+    }
+
     bool operator<(const OrdVector& rhs) const {
         assert(is_sorted());
         assert(rhs.is_sorted());
         return std::lexicographical_compare(vec_.begin(), vec_.end(), rhs.vec_.begin(), rhs.vec_.end());
     }
 
-    const std::vector<Key>& to_vector() const { return vec_; }
+    const VectorType& to_vector() const { return vec_; }
+
+    /// Pointer to the contiguous array of the ordered elements.
+    const Key* data() const { return vec_.data(); }
 
-    bool is_subset_of(const OrdVector& bigger) const {
-        return std::includes(bigger.cbegin(), bigger.cend(), this->cbegin(), this->cend());
+    template <class OtherContainer>
+    bool is_subset_of(const OrdVector<Key, OtherContainer>& bigger) const {
+        if constexpr (set_kernels::Vectorizable<Key>) {
+            return set_kernels::is_subset(data(), size(), bigger.data(), bigger.size());
+        } else {
+            return std::includes(bigger.cbegin(), bigger.cend(), this->cbegin(), this->cend());
+        }
     }
 
     bool is_intersection_empty_with(const OrdVector& rhs) const {
         assert(is_sorted());
         assert(rhs.is_sorted());
 
+        if constexpr (set_kernels::Vectorizable<Key>) {
+            return !set_kernels::intersects(data(), size(), rhs.data(), rhs.size());
+        }
+
         const_iterator itLhs = begin();
         const_iterator itRhs = rhs.begin();
 
@@ -470,6 +900,12 @@ public:
 
         OrdVector result{};
 
+        if constexpr (set_kernels::Vectorizable<Key>) {
+            result.vec_.resize(std::min(lhs.size(), rhs.size()));
+            result.vec_.resize(set_kernels::intersection(lhs.data(), lhs.size(), rhs.data(), rhs.size(), result.vec_.data()));
+            return result;
+        }
+
         auto lhs_it = lhs.begin();
         auto rhs_it = rhs.vec_.begin();
 
@@ -493,10 +929,10 @@ public:
 } // Namespace mata::utils.
 
 namespace std {
-    template <class Key>
-    struct hash<mata::utils::OrdVector<Key>> {
-        std::size_t operator()(const mata::utils::OrdVector<Key>& vec) const {
-            return std::hash<std::vector<Key>>{}(vec.to_vector());
+    template <class Key, class Container>
+    struct hash<mata::utils::OrdVector<Key, Container>> {
+        std::size_t operator()(const mata::utils::OrdVector<Key, Container>& vec) const {
+            return mata::utils::hash_range(vec.cbegin(), vec.cend());
         }
     };
 }
@@ -0,0 +1,207 @@
+/* pool-allocator.hh -- Allocator of small blocks from thread-local pools of size-segregated free lists.
+ */
+
+#ifndef MATA_POOL_ALLOCATOR_HH_
+#define MATA_POOL_ALLOCATOR_HH_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace mata::utils {
+
+/**
+ * @brief Pool of small memory blocks shared by all @c PoolAllocator instances.
+ *
+ * Blocks up to @c MAX_BLOCK_SIZE bytes are carved from large chunks and segregated into size classes of
+ *  @c GRANULARITY bytes. Each thread keeps a free list of blocks per size class: allocating a block pops the free list
+ *  (or bumps a pointer in the current chunk of the thread) and freeing a block pushes it to the free list of the freeing
+ *  thread, both without any locking. Free lists of a finished thread are moved to global free lists, from which other
+ *  threads refill their empty free lists. Chunks are never returned to the system; freed blocks are reused by later
+ *  allocations of the same size class. Larger blocks are allocated by the global @c operator new.
+ */
+namespace pool {
+    /// Size classes are multiples of @c GRANULARITY bytes; it is also the alignment of all pooled blocks.
+    inline constexpr size_t GRANULARITY{ 16 };
+    /// Blocks larger than @c MAX_BLOCK_SIZE bytes are not pooled.
+    inline constexpr size_t MAX_BLOCK_SIZE{ 1024 };
+    inline constexpr size_t NUM_OF_SIZE_CLASSES{ MAX_BLOCK_SIZE / GRANULARITY };
+    /// Size of a chunk blocks are carved from.
+    inline constexpr size_t CHUNK_SIZE{ 256 * 1024 };
+
+    /**
+     * Statistics of the memory reserved by the pool (shared by all threads).
+     */
+    struct Statistics {
+        size_t num_of_chunks{ 0 }; ///< Number of chunks allocated from the system.
+        size_t num_of_reserved_bytes{ 0 }; ///< Bytes of all chunks.
+    };
+
+    namespace internal {
+        /// A free block, linked into a free list.
+        struct FreeBlock { FreeBlock* next; };
+
+        /// State shared by all threads. Never destroyed, so that blocks can be freed during static destruction.
+        struct Global {
+            std::mutex mutex{};
+            std::array<FreeBlock*, NUM_OF_SIZE_CLASSES> free_lists{};
+            /// Number of non-empty @c free_lists (checked without locking the mutex).
+            std::atomic<size_t> num_of_free_lists{ 0 };
+            std::atomic<size_t> num_of_chunks{ 0 };
+        };
+
+        inline Global& global() {
+            static Global* const global{ new Global{} };
+            return *global;
+        }
+
+        /// Free lists of a thread. Trivially destructible so that it is usable until the thread finishes.
+        struct ThreadCache {
+            std::array<FreeBlock*, NUM_OF_SIZE_CLASSES> free_lists;
+            std::byte* chunk_position; ///< Not yet used memory of the current chunk.
+            std::byte* chunk_end;
+            bool registered; ///< Whether the @c ThreadCacheFlusher of the thread has been constructed.
+            bool retired; ///< Whether the thread is finishing and the free lists have been moved to the global ones.
+        };
+
+        inline thread_local constinit ThreadCache thread_cache{};
+
+        inline void push_global(const size_t size_class, FreeBlock* first, FreeBlock* last) {
+            Global& shared{ global() };
+            const std::lock_guard lock{ shared.mutex };
+            if (shared.free_lists[size_class] == nullptr) {
+                shared.num_of_free_lists.fetch_add(1, std::memory_order_relaxed);
+            }
+            last->next = shared.free_lists[size_class];
+            shared.free_lists[size_class] = first;
+        }
+
+        /// Moves free lists of a finishing thread to the global free lists.
+        struct ThreadCacheFlusher {
+            ~ThreadCacheFlusher() {
+                ThreadCache& cache{ thread_cache };
+                for (size_t size_class{ 0 }; size_class < NUM_OF_SIZE_CLASSES; ++size_class) {
+                    FreeBlock* const first{ cache.free_lists[size_class] };
+                    if (first == nullptr) { continue; }
+                    FreeBlock* last{ first };
+                    while (last->next != nullptr) { last = last->next; }
+                    push_global(size_class, first, last);
+                    cache.free_lists[size_class] = nullptr;
+                }
+                cache.retired = true;
+            }
+        };
+
+        inline thread_local ThreadCacheFlusher thread_cache_flusher{};
+
+        constexpr size_t size_class_of(const size_t size) { return (size - 1) / GRANULARITY; }
+        constexpr size_t block_size_of(const size_t size_class) { return (size_class + 1) * GRANULARITY; }
+
+        /// Take the whole global free list of @p size_class, if any.
+        inline FreeBlock* pop_global(const size_t size_class) {
+            Global& shared{ global() };
+            if (shared.num_of_free_lists.load(std::memory_order_relaxed) == 0) { return nullptr; }
+            const std::lock_guard lock{ shared.mutex };
+            FreeBlock* const first{ shared.free_lists[size_class] };
+            if (first != nullptr) {
+                shared.free_lists[size_class] = nullptr;
+                shared.num_of_free_lists.fetch_sub(1, std::memory_order_relaxed);
+            }
+            return first;
+        }
+
+        inline void* allocate_slow(ThreadCache& cache, const size_t size_class) {
+            if (!cache.registered) {
+                cache.registered = true;
+                // Constructs the flusher of this thread (thread-local objects are constructed on their first use).
+                static_cast<void>(&thread_cache_flusher);
+            }
+            if (FreeBlock* const block{ pop_global(size_class) }) {
+                cache.free_lists[size_class] = block->next;
+                return block;
+            }
+            const size_t block_size{ block_size_of(size_class) };
+            if (static_cast<size_t>(cache.chunk_end - cache.chunk_position) < block_size) {
+                // The rest of the current chunk is abandoned; it is smaller than the largest block.
+                cache.chunk_position = static_cast<std::byte*>(
+                    ::operator new(CHUNK_SIZE, std::align_val_t{ GRANULARITY }));
+                cache.chunk_end = cache.chunk_position + CHUNK_SIZE;
+                global().num_of_chunks.fetch_add(1, std::memory_order_relaxed);
+            }
+            void* const block{ cache.chunk_position };
+            cache.chunk_position += block_size;
+            return block;
+        }
+    } // namespace internal.
+
+    /**
+     * Allocate a block of @p size bytes aligned to @c GRANULARITY bytes (or to the default alignment if larger blocks).
+     */
+    inline void* allocate(const size_t size) {
+        if (size == 0 || size > MAX_BLOCK_SIZE) { return ::operator new(size); }
+        internal::ThreadCache& cache{ internal::thread_cache };
+        const size_t size_class{ internal::size_class_of(size) };
+        if (internal::FreeBlock* const block{ cache.free_lists[size_class] }) {
+            cache.free_lists[size_class] = block->next;
+            return block;
+        }
+        return internal::allocate_slow(cache, size_class);
+    }
+
+    /**
+     * Free a block of @p size bytes allocated by @c allocate(). The block can be freed by any thread.
+     */
+    inline void deallocate(void* const ptr, const size_t size) noexcept {
+        if (size == 0 || size > MAX_BLOCK_SIZE) { return ::operator delete(ptr); }
+        internal::ThreadCache& cache{ internal::thread_cache };
+        const size_t size_class{ internal::size_class_of(size) };
+        auto* const block{ static_cast<internal::FreeBlock*>(ptr) };
+        if (cache.retired) { return internal::push_global(size_class, block, block); }
+        block->next = cache.free_lists[size_class];
+        cache.free_lists[size_class] = block;
+    }
+
+    /// @return Statistics of the memory reserved by the pool.
+    inline Statistics statistics() {
+        const size_t num_of_chunks{ internal::global().num_of_chunks.load(std::memory_order_relaxed) };
+        return { .num_of_chunks = num_of_chunks, .num_of_reserved_bytes = num_of_chunks * CHUNK_SIZE };
+    }
+} // namespace pool.
+
+/**
+ * @brief Stateless allocator drawing small blocks from the @c pool.
+ *
+ * Meant for the many small vectors of transition relations: temporary automata then neither call @c malloc nor
+ *  @c free for their symbol posts and targets, and blocks freed by one automaton are reused by the next one.
+ */
+template<class T>
+class PoolAllocator {
+    static_assert(alignof(T) <= pool::GRANULARITY, "PoolAllocator supports only types aligned to at most 16 B.");
+
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    PoolAllocator() noexcept = default;
+    template<class U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) { throw std::bad_array_new_length{}; }
+        return static_cast<T*>(pool::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* const ptr, const size_t n) noexcept { pool::deallocate(ptr, n * sizeof(T)); }
+
+    template<class U>
+    bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+}; // class PoolAllocator.
+
+} // namespace mata::utils.
+
+#endif // MATA_POOL_ALLOCATOR_HH_
@@ -0,0 +1,147 @@
+/* product-storage.hh -- Map from pairs of states to states of a product automaton.
+ */
+
+#ifndef MATA_PRODUCT_STORAGE_HH_
+#define MATA_PRODUCT_STORAGE_HH_
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mata::utils {
+
+/**
+ * @brief Map from pairs of numbers (states of the multiplied automata) to numbers (states of their product).
+ *
+ * The map starts dense: a row of @c num_of_rhs cells is allocated for a left number when the first pair with it is
+ *  inserted, so only rows of left states which are really reached take space, and a lookup is just two indexings.
+ *  When the rows would take more than @c max_dense_size cells, the map switches to an open-addressing hash table with
+ *  linear probing keyed by the pair packed into a single 64-bit number. The table grows with the number of stored
+ *  pairs, keeping the load factor at most 1/2.
+ *
+ * @tparam Number Unsigned integral type of the states. Its maximal value is reserved for @c NOT_FOUND.
+ */
+template<class Number> requires std::is_unsigned_v<Number>
+class ProductStorage {
+public:
+    /// Returned by @c find() for pairs not in the map.
+    static constexpr Number NOT_FOUND = std::numeric_limits<Number>::max();
+    /// The default largest number of cells of the dense rows (about 400 MB for 8-byte numbers).
+    static constexpr size_t MAX_DENSE_SIZE = 50'000'000;
+
+    ProductStorage(const size_t num_of_lhs, const size_t num_of_rhs, const size_t max_dense_size = MAX_DENSE_SIZE)
+        : num_of_rhs_{ num_of_rhs }, max_dense_size_{ max_dense_size } {
+        assert(num_of_rhs == 0 || num_of_lhs <= std::numeric_limits<uint64_t>::max() / num_of_rhs);
+        if (num_of_rhs_ <= max_dense_size_) {
+            rows_.resize(num_of_lhs, NOT_FOUND);
+        } else {
+            table_.assign(MIN_TABLE_SIZE, { 0, NOT_FOUND });
+        }
+    }
+
+    /// Number of stored pairs.
+    size_t size() const { return size_; }
+
+    /// Whether the pairs are stored in the dense rows (and not in the hash table).
+    bool is_dense() const { return table_.empty(); }
+
+    /// The number the pair (@p lhs, @p rhs) is mapped to, @c NOT_FOUND if there is none.
+    Number find(const Number lhs, const Number rhs) const {
+        if (is_dense()) {
+            const Number row{ rows_[lhs] };
+            return row == NOT_FOUND ? NOT_FOUND : cells_[row * num_of_rhs_ + rhs];
+        }
+        const uint64_t key{ pack(lhs, rhs) };
+        for (size_t index{ bucket(key) }; table_[index].second != NOT_FOUND; index = (index + 1) & (table_.size() - 1)) {
+            if (table_[index].first == key) { return table_[index].second; }
+        }
+        return NOT_FOUND;
+    }
+
+    /// Map the pair (@p lhs, @p rhs), which must not be in the map yet, to @p product.
+    void insert(const Number lhs, const Number rhs, const Number product) {
+        assert(product != NOT_FOUND);
+        assert(find(lhs, rhs) == NOT_FOUND);
+        if (is_dense()) {
+            Number& row{ rows_[lhs] };
+            if (row == NOT_FOUND) {
+                if (cells_.size() + num_of_rhs_ > max_dense_size_) {
+                    switch_to_table();
+                    insert(lhs, rhs, product);
+                    return;
+                }
+                row = static_cast<Number>(cells_.size() / num_of_rhs_);
+                cells_.resize(cells_.size() + num_of_rhs_, NOT_FOUND);
+            }
+            cells_[row * num_of_rhs_ + rhs] = product;
+            ++size_;
+            return;
+        }
+        if (2 * (size_ + 1) > table_.size()) { grow_table(); }
+        insert_to_table(pack(lhs, rhs), product);
+        ++size_;
+    }
+
+private:
+    static constexpr size_t MIN_TABLE_SIZE = 1024;
+
+    uint64_t pack(const Number lhs, const Number rhs) const {
+        return static_cast<uint64_t>(lhs) * num_of_rhs_ + rhs;
+    }
+
+    /// The first slot of the hash table to probe for @p key (Fibonacci hashing).
+    size_t bucket(const uint64_t key) const {
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(table_.size())));
+    }
+
+    void insert_to_table(const uint64_t key, const Number product) {
+        size_t index{ bucket(key) };
+        while (table_[index].second != NOT_FOUND) { index = (index + 1) & (table_.size() - 1); }
+        table_[index] = { key, product };
+    }
+
+    /// Double the size of the hash table, inserting the stored pairs again.
+    void grow_table() {
+        std::vector<std::pair<uint64_t, Number>> old_table(2 * table_.size(), { 0, NOT_FOUND });
+        std::swap(table_, old_table);
+        for (const auto& [key, product]: old_table) {
+            if (product != NOT_FOUND) { insert_to_table(key, product); }
+        }
+    }
+
+    /// Move the pairs from the dense rows to a hash table and release the rows.
+    void switch_to_table() {
+        size_t table_size{ MIN_TABLE_SIZE };
+        while (table_size < 2 * (size_ + 1)) { table_size *= 2; }
+        table_.assign(table_size, { 0, NOT_FOUND });
+        for (size_t lhs{ 0 }, num_of_lhs{ rows_.size() }; lhs < num_of_lhs; ++lhs) {
+            if (rows_[lhs] == NOT_FOUND) { continue; }
+            const size_t row_begin{ rows_[lhs] * num_of_rhs_ };
+            for (size_t rhs{ 0 }; rhs < num_of_rhs_; ++rhs) {
+                const Number product{ cells_[row_begin + rhs] };
+                if (product != NOT_FOUND) { insert_to_table(pack(static_cast<Number>(lhs), static_cast<Number>(rhs)), product); }
+            }
+        }
+        rows_ = {};
+        cells_ = {};
+    }
+
+    const size_t num_of_rhs_;
+    const size_t max_dense_size_;
+    size_t size_{ 0 };
+    /// Index of the dense row of each left number, @c NOT_FOUND if it has none yet.
+    std::vector<Number> rows_{};
+    /// Dense rows, one after another.
+    std::vector<Number> cells_{};
+    /// Pairs of packed keys and their numbers, used when the dense rows get too large.
+    std::vector<std::pair<uint64_t, Number>> table_{};
+}; // class ProductStorage.
+
+} // namespace mata::utils.
+
+#endif // MATA_PRODUCT_STORAGE_HH_.
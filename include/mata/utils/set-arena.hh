@@ -0,0 +1,144 @@
+/* set-arena.hh -- Arena of interned sorted sets of numbers addressed by handles.
+ */
+
+#ifndef MATA_SET_ARENA_HH_
+#define MATA_SET_ARENA_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mata::utils {
+
+/**
+ * @brief Arena of interned (deduplicated) sorted sets of numbers, each addressed by a 32-bit handle.
+ *
+ * Elements of all sets are stored back to back in a single vector; a set is identified by its handle, the index of the
+ *  set in the order of interning. Equal sets are stored only once: @c insert() of an already interned set returns the
+ *  handle of the stored set. The lookup uses an open-addressing table of handles.
+ *
+ * The hash of a set is the XOR of hashes of its elements (Zobrist hashing). It does not depend on the order in which
+ *  elements are added, so algorithms compute it while building the set (see @c element_hash()) and the arena never
+ *  rehashes the elements of a set.
+ *
+ * Meant for macrostates of subset constructions: instead of keeping each macrostate in a worklist, as a key of a map
+ *  and in temporary sets, the construction keeps a single copy in the arena and passes 4-byte handles around.
+ *
+ * @tparam Number Unsigned integral type of the elements.
+ */
+template<class Number> requires std::is_unsigned_v<Number>
+class SetArena {
+public:
+    using Handle = uint32_t;
+
+    /**
+     * Hash of a single element; the hash of a set is the XOR of hashes of its elements.
+     */
+    static constexpr size_t element_hash(const Number number) {
+        // SplitMix64 finalizer.
+        uint64_t hash{ static_cast<uint64_t>(number) + 0x9e3779b97f4a7c15ULL };
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<size_t>(hash ^ (hash >> 31));
+    }
+
+    /**
+     * Compute the hash of the set of @p elements.
+     */
+    static size_t hash(const std::span<const Number> elements) {
+        size_t hash{ 0 };
+        for (const Number number: elements) { hash ^= element_hash(number); }
+        return hash;
+    }
+
+    /// @return Number of interned sets.
+    size_t size() const { return hashes_.size(); }
+    bool empty() const { return hashes_.empty(); }
+    /// @return Number of elements of all interned sets.
+    size_t num_of_elements() const { return elements_.size(); }
+
+    /**
+     * Get the elements of the set with @p handle.
+     *
+     * The returned view is invalidated by the next @c insert().
+     */
+    std::span<const Number> operator[](const Handle handle) const {
+        return { elements_.data() + offsets_[handle], elements_.data() + offsets_[handle + 1] };
+    }
+
+    /**
+     * @brief Intern the set of sorted and unique @p elements with the precomputed @p hash.
+     *
+     * @p elements must not be a view of a set in this arena.
+     * @return The handle of the set and @c true if the set was not interned before.
+     */
+    std::pair<Handle, bool> insert(const std::span<const Number> elements, const size_t hash) {
+        if ((size() + 1) * 2 > table_.size()) { grow(); }
+        const size_t mask{ table_.size() - 1 };
+        for (size_t slot{ hash & mask };; slot = (slot + 1) & mask) {
+            const Handle handle{ table_[slot] };
+            if (handle == NO_HANDLE) {
+                if (size() >= NO_HANDLE) { throw std::runtime_error("SetArena: too many sets to intern."); }
+                const auto new_handle{ static_cast<Handle>(size()) };
+                table_[slot] = new_handle;
+                elements_.insert(elements_.end(), elements.begin(), elements.end());
+                offsets_.push_back(elements_.size());
+                hashes_.push_back(hash);
+                return { new_handle, true };
+            }
+            if (hashes_[handle] == hash && std::ranges::equal((*this)[handle], elements)) { return { handle, false }; }
+        }
+    }
+
+    /**
+     * Intern the set of sorted and unique @p elements.
+     */
+    std::pair<Handle, bool> insert(const std::span<const Number> elements) { return insert(elements, hash(elements)); }
+
+    /**
+     * Find the set of sorted and unique @p elements with the precomputed @p hash.
+     * @return Handle of the set, or @c std::nullopt if the set is not interned.
+     */
+    std::optional<Handle> find(const std::span<const Number> elements, const size_t hash) const {
+        if (table_.empty()) { return std::nullopt; }
+        const size_t mask{ table_.size() - 1 };
+        for (size_t slot{ hash & mask };; slot = (slot + 1) & mask) {
+            const Handle handle{ table_[slot] };
+            if (handle == NO_HANDLE) { return std::nullopt; }
+            if (hashes_[handle] == hash && std::ranges::equal((*this)[handle], elements)) { return handle; }
+        }
+    }
+
+    std::optional<Handle> find(const std::span<const Number> elements) const { return find(elements, hash(elements)); }
+
+private:
+    static constexpr Handle NO_HANDLE{ std::numeric_limits<Handle>::max() };
+    static constexpr size_t INITIAL_TABLE_SIZE{ 64 };
+
+    std::vector<Number> elements_{}; ///< Elements of all sets, ordered by handles of the sets.
+    std::vector<size_t> offsets_{ 0 }; ///< Offset of the first element of each set, followed by the number of elements.
+    std::vector<size_t> hashes_{}; ///< Hash of each set.
+    std::vector<Handle> table_{}; ///< Open-addressing table of handles (linear probing), kept at most half full.
+
+    void grow() {
+        std::vector<Handle> table(std::max(table_.size() * 2, INITIAL_TABLE_SIZE), NO_HANDLE);
+        const size_t mask{ table.size() - 1 };
+        for (Handle handle{ 0 }; handle < size(); ++handle) {
+            size_t slot{ hashes_[handle] & mask };
+            while (table[slot] != NO_HANDLE) { slot = (slot + 1) & mask; }
+            table[slot] = handle;
+        }
+        table_ = std::move(table);
+    }
+}; // class SetArena.
+
+} // namespace mata::utils.
+
+#endif // MATA_SET_ARENA_HH_
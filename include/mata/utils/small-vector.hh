@@ -0,0 +1,245 @@
+/* small-vector.hh -- Vector with inline storage for a few elements.
+ */
+
+#ifndef MATA_SMALL_VECTOR_HH_
+#define MATA_SMALL_VECTOR_HH_
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace mata::utils {
+
+/**
+ * @brief Vector of trivially copyable elements storing up to @p N elements inline, without any heap allocation.
+ *
+ * The inline elements share the storage with the pointer to the heap-allocated elements, hence the vector occupies
+ *  only a pointer and two 32-bit counters (16 B on 64-bit platforms). The default @p N is the number of elements which
+ *  fit into a pointer. Once the vector grows over @p N elements, it moves its elements to the heap and never moves
+ *  them back (same as @c std::vector never releases its capacity).
+ *
+ * The interface is the subset of the @c std::vector interface which is needed by @c OrdVector. Contrary to
+ *  @c std::vector, moving a vector with inline elements invalidates iterators to its elements.
+ *
+ * @tparam T Type of the elements.
+ * @tparam N Number of elements stored inline.
+ * @tparam Allocator Stateless allocator of the heap-allocated elements.
+ */
+template<class T, size_t N = std::max(sizeof(void*) / sizeof(T), size_t{ 1 }), class Allocator = std::allocator<T>>
+class SmallVector {
+    static_assert(std::is_trivially_copyable_v<T>, "SmallVector supports only trivially copyable elements.");
+    static_assert(N >= 1, "SmallVector must have an inline capacity of at least one element.");
+    static_assert(std::allocator_traits<Allocator>::is_always_equal::value,
+                  "SmallVector supports only stateless allocators.");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /// Number of elements stored inline.
+    static constexpr size_t inline_capacity = N;
+
+    SmallVector() noexcept {}
+    explicit SmallVector(const size_t count) { resize(count); }
+    SmallVector(const size_t count, const T& value) { assign_fill(count, value); }
+    template<std::input_iterator InputIterator>
+    SmallVector(InputIterator first, InputIterator last) { append(first, last); }
+    SmallVector(std::initializer_list<T> list) { append(list.begin(), list.end()); }
+    SmallVector(const SmallVector& other) { append(other.begin(), other.end()); }
+    SmallVector(SmallVector&& other) noexcept { steal(other); }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            append(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            release();
+            steal(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> list) {
+        clear();
+        append(list.begin(), list.end());
+        return *this;
+    }
+
+    ~SmallVector() { release(); }
+
+    /**
+     * Whether the elements are stored inline (no heap memory is owned by the vector).
+     */
+    bool is_inline() const { return capacity_ <= N; }
+
+    T* data() { return is_inline() ? inline_ : heap_; }
+    const T* data() const { return is_inline() ? inline_ : heap_; }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return capacity_; }
+
+    T& operator[](const size_t index) { assert(index < size_); return data()[index]; }
+    const T& operator[](const size_t index) const { assert(index < size_); return data()[index]; }
+    T& front() { assert(!empty()); return data()[0]; }
+    const T& front() const { assert(!empty()); return data()[0]; }
+    T& back() { assert(!empty()); return data()[size_ - 1]; }
+    const T& back() const { assert(!empty()); return data()[size_ - 1]; }
+
+    void reserve(const size_t new_capacity) { if (new_capacity > capacity_) { grow_to(new_capacity); } }
+
+    void resize(const size_t new_size) { resize(new_size, T{}); }
+    void resize(const size_t new_size, const T& value) {
+        reserve(new_size);
+        if (new_size > size_) { std::fill(end(), data() + new_size, value); }
+        size_ = static_cast<SizeType>(new_size);
+    }
+
+    void clear() { size_ = 0; }
+
+    void push_back(const T& value) { emplace_back(value); }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        // Construct the value first, as @p args might refer to an element of this vector which growing invalidates.
+        T value(std::forward<Args>(args)...);
+        if (size_ == capacity_) { grow_to(next_capacity(size_ + 1)); }
+        T* const slot{ data() + size_ };
+        *slot = value;
+        ++size_;
+        return *slot;
+    }
+
+    void pop_back() { assert(!empty()); --size_; }
+
+    iterator insert(const_iterator pos, const T& value) {
+        const size_t index{ static_cast<size_t>(pos - begin()) };
+        assert(index <= size_);
+        const T inserted{ value };
+        if (size_ == capacity_) { grow_to(next_capacity(size_ + 1)); }
+        T* const slot{ data() + index };
+        std::memmove(slot + 1, slot, (size_ - index) * sizeof(T));
+        *slot = inserted;
+        ++size_;
+        return slot;
+    }
+
+    template<std::input_iterator InputIterator>
+    iterator insert(const_iterator pos, InputIterator first, InputIterator last) {
+        const size_t index{ static_cast<size_t>(pos - begin()) };
+        assert(index <= size_);
+        const SmallVector inserted(first, last);
+        if (size_ + inserted.size() > capacity_) { grow_to(next_capacity(size_ + inserted.size())); }
+        T* const slot{ data() + index };
+        std::memmove(slot + inserted.size(), slot, (size_ - index) * sizeof(T));
+        std::copy(inserted.begin(), inserted.end(), slot);
+        size_ += inserted.size_;
+        return slot;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        T* const erased{ begin() + (first - cbegin()) };
+        const size_t num_of_erased{ static_cast<size_t>(last - first) };
+        std::memmove(erased, erased + num_of_erased, static_cast<size_t>(end() - (erased + num_of_erased)) * sizeof(T));
+        size_ -= static_cast<SizeType>(num_of_erased);
+        return erased;
+    }
+
+    bool operator==(const SmallVector& other) const { return std::equal(begin(), end(), other.begin(), other.end()); }
+    auto operator<=>(const SmallVector& other) const {
+        return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+    }
+
+    /// Copy the elements into a @c std::vector (for interoperability with code working with @c std::vector).
+    operator std::vector<T>() const { return std::vector<T>(begin(), end()); }
+
+private:
+    /// Counters are 32-bit so that the vector fits into 16 B together with the pointer to the heap elements.
+    using SizeType = uint32_t;
+
+    union {
+        T* heap_; ///< Heap-allocated elements (if capacity_ > N).
+        T inline_[N]; ///< Elements stored inline (if capacity_ <= N).
+    };
+    SizeType size_{ 0 };
+    SizeType capacity_{ N };
+
+    size_t next_capacity(const size_t needed) const { return std::max(needed, 2 * static_cast<size_t>(capacity_)); }
+
+    void grow_to(const size_t new_capacity) {
+        assert(new_capacity > capacity_);
+        assert(new_capacity <= UINT32_MAX);
+        T* const new_heap{ Allocator{}.allocate(new_capacity) };
+        if (size_ != 0) { std::memcpy(new_heap, data(), size_ * sizeof(T)); }
+        release();
+        heap_ = new_heap;
+        capacity_ = static_cast<SizeType>(new_capacity);
+    }
+
+    void release() {
+        if (!is_inline()) {
+            Allocator{}.deallocate(heap_, capacity_);
+            capacity_ = N;
+        }
+    }
+
+    /// Take over the elements of @p other, leaving @p other empty. Expects this vector to own no heap memory.
+    void steal(SmallVector& other) {
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        if (other.is_inline()) {
+            std::memcpy(inline_, other.inline_, size_ * sizeof(T));
+        } else {
+            heap_ = other.heap_;
+            other.capacity_ = N;
+        }
+        other.size_ = 0;
+    }
+
+    void assign_fill(const size_t count, const T& value) {
+        reserve(count);
+        std::fill(data(), data() + count, value);
+        size_ = static_cast<SizeType>(count);
+    }
+
+    template<std::input_iterator InputIterator>
+    void append(InputIterator first, InputIterator last) {
+        if constexpr (std::forward_iterator<InputIterator>) {
+            reserve(size_ + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) { emplace_back(*first); }
+    }
+}; // class SmallVector.
+
+} // namespace mata::utils.
+
+#endif // MATA_SMALL_VECTOR_HH_
@@ -126,6 +126,7 @@ public:
             if (this->positions[i] == this->ends[i]) { return false; }
 
             //  Advance position[i] and position[0] to the closest equal values.
+            const Iterator first_position{ this->positions[0] };
             while (*this->positions[i] != *this->positions[0]) {
 
                 // Advance position[i] to or beyond position[0].
@@ -140,14 +141,10 @@ public:
                     if (this->positions[0] == this->ends[0]) { return false; }
                 }
 
-                // If position[0] changed, start from position 1 again.
-                // (note that
-                // i gets incremented at the end of the for-loop body,
-                // and that,
-                // since we are inside the for, there are at least two positions
-                // as the for starts with i=1.)
-                if (this->positions[0] > this->positions[1]) { i=0; }
             }
+            // If position[0] changed, the positions before i have to be synchronized with it again, start from
+            //  position 1 again (i gets incremented at the end of the for-loop body).
+            if (i > 1 && this->positions[0] != first_position) { i = 0; }
         }
         this->synchronized_at_current_minimum = true;
         return true;
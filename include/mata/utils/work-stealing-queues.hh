@@ -0,0 +1,114 @@
+/* work-stealing-queues.hh -- Per-worker queues of tasks with work stealing.
+ */
+
+#ifndef MATA_WORK_STEALING_QUEUES_HH_
+#define MATA_WORK_STEALING_QUEUES_HH_
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mata::utils {
+
+/**
+ * @brief Queues of tasks of a fixed number of worker threads, where idle workers steal tasks from the others.
+ *
+ * Each worker pushes the tasks it creates to its own queue and pops them from the same end (depth-first, as a stack),
+ *  idle workers steal the oldest tasks from the other end of the queues of the other workers. The queues count tasks
+ *  which have been pushed but not yet reported as done, so that workers recognize the end of the computation: @c pop()
+ *  waits until either a task is available, or there are no unfinished tasks, or the computation is cancelled.
+ *
+ * A worker runs
+ * ```cpp
+ * while (std::optional<Task> task{ queues.pop(worker) }) {
+ *     // Process the task, pushing new tasks by queues.push(worker, new_task).
+ *     queues.task_done();
+ * }
+ * ```
+ *
+ * @tparam Task Type of tasks.
+ */
+template<class Task>
+class WorkStealingQueues {
+public:
+    explicit WorkStealingQueues(const size_t num_of_workers) : queues_(num_of_workers) {}
+
+    size_t num_of_workers() const { return queues_.size(); }
+
+    /**
+     * Push a new @p task to the queue of @p worker.
+     */
+    void push(const size_t worker, Task task) {
+        num_of_unfinished_tasks_.fetch_add(1, std::memory_order_relaxed);
+        Queue& queue{ queues_[worker] };
+        const std::lock_guard lock{ queue.mutex };
+        queue.tasks.push_back(std::move(task));
+    }
+
+    /**
+     * @brief Get a task for @p worker, either the newest task of its own queue or the oldest task of another queue.
+     *
+     * Waits while all queues are empty and other workers are processing tasks (which may push new tasks).
+     * @return The task, or @c std::nullopt if all tasks are done or the computation is cancelled.
+     */
+    std::optional<Task> pop(const size_t worker) {
+        while (!cancelled_.load(std::memory_order_relaxed)) {
+            if (std::optional<Task> task{ pop_back(queues_[worker]) }) { return task; }
+            for (size_t offset{ 1 }; offset < queues_.size(); ++offset) {
+                if (std::optional<Task> task{ pop_front(queues_[(worker + offset) % queues_.size()]) }) {
+                    return task;
+                }
+            }
+            if (num_of_unfinished_tasks_.load(std::memory_order_acquire) == 0) { return std::nullopt; }
+            std::this_thread::yield();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * Report that a task returned by @c pop() has been processed (after pushing the tasks it created).
+     */
+    void task_done() { num_of_unfinished_tasks_.fetch_sub(1, std::memory_order_acq_rel); }
+
+    /**
+     * Stop the computation: @c pop() returns @c std::nullopt from now on.
+     */
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool is_cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+private:
+    /// Queue of a single worker, aligned to a cache line to prevent false sharing between workers.
+    struct alignas(64) Queue {
+        std::mutex mutex{};
+        std::deque<Task> tasks{};
+    };
+
+    std::vector<Queue> queues_;
+    std::atomic<size_t> num_of_unfinished_tasks_{ 0 };
+    std::atomic<bool> cancelled_{ false };
+
+    static std::optional<Task> pop_back(Queue& queue) {
+        const std::lock_guard lock{ queue.mutex };
+        if (queue.tasks.empty()) { return std::nullopt; }
+        std::optional<Task> task{ std::move(queue.tasks.back()) };
+        queue.tasks.pop_back();
+        return task;
+    }
+
+    static std::optional<Task> pop_front(Queue& queue) {
+        const std::lock_guard lock{ queue.mutex };
+        if (queue.tasks.empty()) { return std::nullopt; }
+        std::optional<Task> task{ std::move(queue.tasks.front()) };
+        queue.tasks.pop_front();
+        return task;
+    }
+}; // class WorkStealingQueues.
+
+} // namespace mata::utils.
+
+#endif // MATA_WORK_STEALING_QUEUES_HH_
@@ -64,6 +64,8 @@ Nfa builder::construct(const mata::parser::ParsedSection& parsec, mata::Alphabet
         }
     }
 
+    std::vector<Transition> transitions{};
+    transitions.reserve(parsec.body.size());
     for (const auto& body_line : parsec.body)
     {
         if (body_line.size() != 3)
@@ -87,8 +89,9 @@ Nfa builder::construct(const mata::parser::ParsedSection& parsec, mata::Alphabet
         Symbol symbol = alphabet->translate_symb(body_line[1]);
         State tgt_state = get_state_name(body_line[2]);
 
-        aut.delta.add(src_state, symbol, tgt_state);
+        transitions.emplace_back(src_state, symbol, tgt_state);
     }
+    aut.delta.add_bulk(std::move(transitions));
 
     // do the dishes and take out garbage
     clean_up();
@@ -127,6 +130,8 @@ Nfa builder::construct(const mata::IntermediateAut& inter_aut, mata::Alphabet* a
         aut.initial.insert(state);
     }
 
+    std::vector<Transition> transitions{};
+    transitions.reserve(inter_aut.transitions.size());
     for (const auto& trans : inter_aut.transitions)
     {
         if (trans.second.children.size() != 2)
@@ -145,8 +150,9 @@ Nfa builder::construct(const mata::IntermediateAut& inter_aut, mata::Alphabet* a
         Symbol symbol = alphabet->translate_symb(trans.second.children[0].node.name);
         State tgt_state = get_state_name(trans.second.children[1].node.name);
 
-        aut.delta.add(src_state, symbol, tgt_state);
+        transitions.emplace_back(src_state, symbol, tgt_state);
     }
+    aut.delta.add_bulk(std::move(transitions));
 
     std::unordered_set<std::string> final_formula_nodes;
     if (!(inter_aut.final_formula.node.is_constant())) {
@@ -186,7 +192,7 @@ void builder::construct(
 
 Nfa builder::create_single_word_nfa(const std::vector<Symbol>& word) {
     const size_t word_size{ word.size() };
-    Nfa nfa{ word_size + 1, { 0 }, { word_size } };
+    Nfa nfa{ word_size + 1, { 0 }, { static_cast<State>(word_size) } };
 
     for (State state{ 0 }; state < word_size; ++state) {
         nfa.delta.add(state, word[state], state + 1);
@@ -199,7 +205,7 @@ Nfa builder::create_single_word_nfa(const std::vector<std::string>& word, mata::
         alphabet = new OnTheFlyAlphabet{ word };
     }
     const size_t word_size{ word.size() };
-    Nfa nfa{ word_size + 1, { 0 }, { word_size }, alphabet };
+    Nfa nfa{ word_size + 1, { 0 }, { static_cast<State>(word_size) }, alphabet };
 
     for (State state{ 0 }; state < word_size; ++state) {
         nfa.delta.add(state, alphabet->translate_symb(word[state]), state + 1);
@@ -257,14 +263,17 @@ Nfa builder::create_random_nfa_tabakov_vardi(const size_t num_of_states, const s
     // Using std::min because, in some universe, casting and rounding might cause the number of transitions to exceed the number of possible transitions by 1
     // and then an access to the non-existing element of one_dimensional_transition_matrix would occur.
     const size_t num_of_transitions_per_symbol{ std::min(static_cast<size_t>(std::round(static_cast<double>(num_of_states) * states_trans_ratio_per_symbol)), one_dimensional_transition_matrix.size()) };
+    std::vector<Transition> transitions{};
+    transitions.reserve(alphabet_size * num_of_transitions_per_symbol);
     for (Symbol symbol{ 0 }; symbol < alphabet_size; ++symbol) {
         std::shuffle(one_dimensional_transition_matrix.begin(), one_dimensional_transition_matrix.end(), gen);
         for (size_t i = 0; i < num_of_transitions_per_symbol; ++i) {
-            const State source{ one_dimensional_transition_matrix[i] / num_of_states };
-            const State target{ one_dimensional_transition_matrix[i] % num_of_states };
-            nfa.delta.add(source, symbol, target);
+            const State source{ static_cast<State>(one_dimensional_transition_matrix[i] / num_of_states) };
+            const State target{ static_cast<State>(one_dimensional_transition_matrix[i] % num_of_states) };
+            transitions.emplace_back(source, symbol, target);
         }
     }
+    nfa.delta.add_bulk(std::move(transitions));
     return nfa;
 }
 
@@ -8,8 +8,11 @@
 using namespace mata::nfa;
 using namespace mata::utils;
 
-Nfa mata::nfa::algorithms::complement_classical(const Nfa& aut, const OrdVector<Symbol>& symbols) {
-    return determinize(aut)
+Nfa mata::nfa::algorithms::complement_classical(const Nfa& aut, const OrdVector<Symbol>& symbols,
+                                               const std::optional<Symbol> first_epsilon) {
+    ParameterMap params{};
+    if (first_epsilon.has_value()) { params["first_epsilon"] = std::to_string(*first_epsilon); }
+    return determinize(aut, nullptr, std::nullopt, params)
         .trim()
         .complement_deterministic(symbols);
 }
@@ -30,21 +33,22 @@ Nfa mata::nfa::complement(const Nfa& aut, const Alphabet& alphabet, const Parame
 }
 
 Nfa mata::nfa::complement(const Nfa& aut, const mata::utils::OrdVector<mata::Symbol>& symbols, const ParameterMap& params) {
-    // Setting the requested algorithm.
-    decltype(algorithms::complement_classical)* algo = algorithms::complement_classical;
     if (!haskey(params, "algorithm")) {
         throw std::runtime_error(std::to_string(__func__) +
                                  " requires setting the \"algorithm\" key in the \"params\" argument; "
                                  "received: " + std::to_string(params));
     }
+    const std::optional<Symbol> first_epsilon{ algorithms::get_first_epsilon(params) };
 
     const std::string& str_algo = params.at("algorithm");
-    if ("classical" == str_algo) {  /* default */ }
-    else if ("brzozowski" == str_algo) {  algo = algorithms::complement_brzozowski; }
-    else {
-        throw std::runtime_error(std::to_string(__func__) +
-                                 " received an unknown value of the \"algorithm\" key: " + str_algo);
+    if ("classical" == str_algo) { return algorithms::complement_classical(aut, symbols, first_epsilon); }
+    if ("brzozowski" == str_algo) {
+        if (first_epsilon.has_value()) {
+            throw std::runtime_error(std::to_string(__func__) +
+                                     " supports the \"first_epsilon\" key only with the \"classical\" algorithm");
+        }
+        return algorithms::complement_brzozowski(aut, symbols);
     }
-
-    return algo(aut, symbols);
+    throw std::runtime_error(std::to_string(__func__) +
+                             " received an unknown value of the \"algorithm\" key: " + str_algo);
 }
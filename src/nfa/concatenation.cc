@@ -17,7 +17,7 @@ Nfa concatenate(const Nfa& lhs, const Nfa& rhs, bool use_epsilon,
 Nfa& Nfa::concatenate(const Nfa& aut) {
     size_t n = this->num_of_states();
     auto upd_fnc = [&](State st) {
-        return st + n;
+        return static_cast<State>(st + n);
     };
 
     // copy the information about aut to save the case when this is the same object as aut.
@@ -93,7 +93,7 @@ Nfa algorithms::concatenate_eps(const Nfa& lhs, const Nfa& rhs, const Symbol& ep
     result = Nfa();
     result.delta = lhs.delta;
     result.initial = lhs.initial;
-    result.add_state(result_num_of_states-1);
+    result.add_state(static_cast<State>(result_num_of_states - 1));
 
     // Add epsilon transitions connecting lhs and rhs automata.
     // The epsilon transitions lead from lhs original final states to rhs original initial states.
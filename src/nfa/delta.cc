@@ -9,7 +9,9 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <numeric>
 #include <iterator>
 #include <queue>
 
@@ -19,6 +21,41 @@ using mata::Symbol;
 
 using StateBoolArray = std::vector<bool>; ///< Bool array for states in the automaton.
 
+namespace {
+/**
+ * Unify ordered targets of the symbol posts pointed to by @p symbol_post_its using a priority queue.
+ * @tparam SymbolPostIterator Iterator to @c SymbolPost or @c FrozenSymbolPost.
+ */
+template<class SymbolPostIterator>
+StateSet unify_targets_of(const std::vector<SymbolPostIterator>& symbol_post_its) {
+    StateSet unified_targets{};
+    if (symbol_post_its.size() == 1) {
+        const auto& symbol_post{ *symbol_post_its.front() };
+        unified_targets.reserve(symbol_post.num_of_targets());
+        for (const State target: symbol_post.targets) { unified_targets.push_back(target); }
+        return unified_targets;
+    }
+
+    using TargetIterator = decltype(symbol_post_its.front()->cbegin());
+    using TargetSetBeginEndPair = std::pair<TargetIterator, TargetIterator>;
+    auto compare = [](const auto& a, const auto& b) { return *(a.first) > *(b.first); };
+    std::priority_queue<TargetSetBeginEndPair, std::vector<TargetSetBeginEndPair>, decltype(compare) > queue(compare);
+    for (const SymbolPostIterator& symbol_post_it: symbol_post_its) {
+        queue.emplace(symbol_post_it->cbegin(), symbol_post_it->cend());
+    }
+    unified_targets.reserve(32);
+    while (!queue.empty()) {
+        auto item = queue.top();
+        queue.pop();
+        if (unified_targets.empty() || unified_targets.back() != *(item.first)) {
+            unified_targets.push_back(*(item.first));
+        }
+        if (++item.first != item.second) { queue.emplace(item); }
+    }
+    return unified_targets;
+}
+} // namespace.
+
 SymbolPost& SymbolPost::operator=(SymbolPost&& rhs) noexcept {
     if (*this != rhs) {
         symbol = rhs.symbol;
@@ -47,6 +84,12 @@ void SymbolPost::insert(const StateSet& states) {
     }
 }
 
+void SymbolPost::insert(const TargetSet& states) {
+    for (State s : states) {
+        insert(s);
+    }
+}
+
 StatePost::const_iterator Delta::epsilon_symbol_posts(const State state, const Symbol epsilon) const {
     return epsilon_symbol_posts(state_post(state), epsilon);
 }
@@ -75,7 +118,23 @@ std::vector<Transition> Delta::get_transitions_to(const State state_to) const {
     return transitions_to_state;
 }
 
+Delta& Delta::operator=(Delta&& other) noexcept {
+    if (this != &other) {
+        state_posts_ = std::move(other.state_posts_);
+        content_id_ = other.content_id_;
+        other.content_changed();
+    }
+    return *this;
+}
+
+size_t Delta::content_id() const {
+    static std::atomic<size_t> next_content_id{ 1 };
+    if (content_id_ == 0) { content_id_ = next_content_id.fetch_add(1, std::memory_order_relaxed); }
+    return content_id_;
+}
+
 void Delta::add(const State source, Symbol symbol, const State target) {
+    content_changed();
     if (const State max_state{ std::max(source, target) }; max_state >= state_posts_.size()) {
         reserve_on_insert(state_posts_, max_state);
         state_posts_.resize(max_state + 1);
@@ -100,6 +159,7 @@ void Delta::add(const State source, Symbol symbol, const State target) {
 
 void Delta::add(const State source, const Symbol symbol, const StateSet& targets) {
     if(targets.empty()) { return; }
+    content_changed();
 
     if (const State max_state{ std::max(source, targets.back()) }; max_state >= state_posts_.size()) {
         reserve_on_insert(state_posts_, max_state + 1);
@@ -124,7 +184,70 @@ void Delta::add(const State source, const Symbol symbol, const StateSet& targets
     }
 }
 
+void Delta::add_bulk(std::vector<Transition>&& transitions) {
+    if (transitions.empty()) { return; }
+    content_changed();
+
+    State max_state{ 0 };
+    for (const Transition& transition: transitions) {
+        max_state = std::max({ max_state, transition.source, transition.target });
+    }
+    if (max_state >= state_posts_.size()) { state_posts_.resize(max_state + 1); }
+
+    // Counting sort of the moves by their source states.
+    std::vector<size_t> source_offsets(num_of_states() + 1, 0);
+    for (const Transition& transition: transitions) { ++source_offsets[transition.source + 1]; }
+    std::partial_sum(source_offsets.begin(), source_offsets.end(), source_offsets.begin());
+    std::vector<Move> moves(transitions.size());
+    {
+        std::vector<size_t> next_move_index(source_offsets.begin(), source_offsets.end() - 1);
+        for (const Transition& transition: transitions) {
+            moves[next_move_index[transition.source]++] = Move{ transition.symbol, transition.target };
+        }
+    }
+    transitions.clear();
+    transitions.shrink_to_fit();
+
+    const auto move_less = [](const Move& lhs, const Move& rhs) {
+        return lhs.symbol < rhs.symbol || (lhs.symbol == rhs.symbol && lhs.target < rhs.target);
+    };
+    for (State source{ 0 }; source < num_of_states(); ++source) {
+        const auto moves_begin{ moves.begin() + static_cast<long>(source_offsets[source]) };
+        auto moves_end{ moves.begin() + static_cast<long>(source_offsets[source + 1]) };
+        if (moves_begin == moves_end) { continue; }
+        std::sort(moves_begin, moves_end, move_less);
+        moves_end = std::unique(moves_begin, moves_end);
+
+        // Group the sorted moves by symbols into the symbol posts.
+        StatePost state_post{};
+        for (auto symbol_begin{ moves_begin }; symbol_begin != moves_end;) {
+            const Symbol symbol{ symbol_begin->symbol };
+            const auto symbol_end{ std::find_if(symbol_begin, moves_end,
+                                                [symbol](const Move& move) { return move.symbol != symbol; }) };
+            TargetSet targets{};
+            targets.reserve(static_cast<size_t>(symbol_end - symbol_begin));
+            for (; symbol_begin != symbol_end; ++symbol_begin) { targets.push_back(symbol_begin->target); }
+            state_post.emplace_back(symbol, std::move(targets));
+        }
+
+        StatePost& existing_state_post{ state_posts_[source] };
+        if (existing_state_post.empty()) {
+            existing_state_post = std::move(state_post);
+        } else {
+            for (const SymbolPost& symbol_post: state_post) {
+                if (const auto existing_symbol_post{ existing_state_post.find(symbol_post.symbol) };
+                    existing_symbol_post != existing_state_post.end()) {
+                    existing_symbol_post->insert(symbol_post.targets);
+                } else {
+                    existing_state_post.insert(symbol_post);
+                }
+            }
+        }
+    }
+}
+
 void Delta::remove(const State source, const Symbol symbol, const State target) {
+    content_changed();
     if (source >= state_posts_.size()) { return; }
 
     if (StatePost& state_transitions{ state_posts_[source] }; state_transitions.empty()) {
@@ -170,13 +293,42 @@ bool Delta::contains(const Transition& transition) const {
 }
 
 size_t Delta::num_of_transitions() const {
-    size_t number_of_transitions{ 0 };
-    for (const StatePost& state_post: state_posts_) {
-        for (const SymbolPost& symbol_post: state_post) {
-            number_of_transitions += symbol_post.num_of_targets();
+    return reduce_by_chunks(size_t{ 0 }, [&](const State first_source, const State last_source) {
+        size_t number_of_transitions{ 0 };
+        for (State source{ first_source }; source < last_source; ++source) {
+            for (const SymbolPost& symbol_post: state_posts_[source]) {
+                number_of_transitions += symbol_post.num_of_targets();
+            }
+        }
+        return number_of_transitions;
+    }, [](size_t& number_of_transitions, const size_t chunk_number_of_transitions) {
+        number_of_transitions += chunk_number_of_transitions;
+    });
+}
+
+std::vector<std::pair<State, State>> Delta::split_into_chunks(const size_t num_of_chunks) const {
+    const size_t num_of_states{ this->num_of_states() };
+    const size_t max_num_of_chunks{ std::max(num_of_states / MIN_STATES_PER_CHUNK, size_t{ 1 }) };
+    const size_t num_of_created_chunks{ std::clamp(num_of_chunks, size_t{ 1 }, max_num_of_chunks) };
+    if (num_of_created_chunks == 1) { return { { 0, static_cast<State>(num_of_states) } }; }
+
+    // Each state weights one plus the number of its symbol posts.
+    size_t total_weight{ num_of_states };
+    for (const StatePost& state_post: state_posts_) { total_weight += state_post.size(); }
+    std::vector<std::pair<State, State>> chunks{};
+    chunks.reserve(num_of_created_chunks);
+    State first_source{ 0 };
+    size_t weight{ 0 };
+    for (State source{ 0 }; source < num_of_states; ++source) {
+        weight += 1 + state_posts_[source].size();
+        if (weight * num_of_created_chunks >= total_weight * (chunks.size() + 1)
+            && chunks.size() + 1 < num_of_created_chunks) {
+            chunks.emplace_back(first_source, source + 1);
+            first_source = source + 1;
         }
     }
-    return number_of_transitions;
+    chunks.emplace_back(first_source, static_cast<State>(num_of_states));
+    return chunks;
 }
 
 bool Delta::empty() const {
@@ -185,7 +337,7 @@ bool Delta::empty() const {
 
 Delta::Transitions::const_iterator::const_iterator(const Delta& delta): delta_{ &delta } {
     const size_t post_size = delta_->num_of_states();
-    for (size_t i = 0; i < post_size; ++i) {
+    for (State i = 0; i < post_size; ++i) {
         if (!(*delta_)[i].empty()) {
             current_state_ = i;
             state_post_it_ = (*delta_)[i].begin();
@@ -295,6 +447,7 @@ std::vector<StatePost> Delta::renumber_targets(const std::function<State(State)>
 }
 
 StatePost& Delta::mutable_state_post(State q) {
+    content_changed();
     if (q >= state_posts_.size()) {
         utils::reserve_on_insert(state_posts_, q);
         const size_t new_size{ q + 1 };
@@ -306,6 +459,7 @@ StatePost& Delta::mutable_state_post(State q) {
 
 void Delta::defragment(const BoolVector& is_staying, const std::vector<State>& renaming) {
     //TODO: this function seems to be unreadable, should be refactored, maybe into several functions with a clear functionality?
+    content_changed();
 
     //first, indexes of post are filtered (places of to be removed states are taken by states on their right)
     size_t move_index{ 0 };
@@ -319,7 +473,7 @@ void Delta::defragment(const BoolVector& is_staying, const std::vector<State>& r
 
     //this iterates through every post and every move, filters and renames states,
     //and then removes moves that became empty.
-    for (State q=0,size=state_posts_.size(); q < size; ++q) {
+    for (State q = 0, size = static_cast<State>(state_posts_.size()); q < size; ++q) {
         StatePost & p = mutable_state_post(q);
         for (auto move = p.begin(); move < p.end(); ++move) {
             move->targets.erase(
@@ -511,8 +665,11 @@ OrdVector<Symbol> Delta::get_used_symbols() const {
     //that then must be converted to an OrdVector
     //measured are times with "mata::nfa::get_used_symbols speed, harder", "[.profiling]" now on line 104 of nfa-profiling.cc
 
+    //WITH VECTOR, CHUNKS OF STATE POSTS IN PARALLEL (the same as WITH VECTOR for a single thread or small automata)
+    return get_used_symbols_par();
+
     //WITH VECTOR (4.434 s)
-    return get_used_symbols_vec();
+    //return get_used_symbols_vec();
 
     //WITH SET (26.5 s)
     //auto from_set = get_used_symbols_set();
@@ -578,6 +735,20 @@ mata::utils::OrdVector<Symbol> Delta::get_used_symbols_vec() const {
     return sorted_symbols;
 }
 
+// Collects symbols of chunks of state posts in parallel and unites them.
+mata::utils::OrdVector<Symbol> Delta::get_used_symbols_par() const {
+    return reduce_by_chunks(OrdVector<Symbol>{}, [&](const State first_source, const State last_source) {
+        std::vector<Symbol> symbols{};
+        for (State source{ first_source }; source < last_source; ++source) {
+            for (const SymbolPost& symbol_post: state_posts_[source]) {
+                utils::reserve_on_insert(symbols);
+                symbols.push_back(symbol_post.symbol);
+            }
+        }
+        return OrdVector<Symbol>(symbols);
+    }, [](OrdVector<Symbol>& symbols, const OrdVector<Symbol>& chunk_symbols) { symbols.insert(chunk_symbols); });
+}
+
 // returns symbols appearing in Delta, inserts to a std::set
 std::set<Symbol> Delta::get_used_symbols_set() const {
     //static should prevent reallocation, seems to speed things up a little
@@ -677,8 +848,6 @@ StateSet SynchronizedExistentialSymbolPostIterator::unify_targets() const {
 
     if(!is_synchronized()) { return {}; }
 
-    StateSet unified_targets{};
-
     // Version with synchronized iterator.
     // static utils::SynchronizedExistentialIterator<StateSet::const_iterator> sync_iterator;
     // sync_iterator.reset();
@@ -698,23 +867,7 @@ StateSet SynchronizedExistentialSymbolPostIterator::unify_targets() const {
     // }
 
     // Version with priority queue.
-    using TargetSetBeginEndPair = std::pair<StateSet::const_iterator, StateSet::const_iterator>;
-    auto compare = [](const auto& a, const auto& b) { return *(a.first) > *(b.first); };
-    std::priority_queue<TargetSetBeginEndPair, std::vector<TargetSetBeginEndPair>, decltype(compare) > queue(compare);
-    for (const StatePost::const_iterator& symbol_post_it: get_current()) {
-        queue.emplace(symbol_post_it->cbegin(), symbol_post_it->cend());
-    }
-    unified_targets.reserve(32);
-    while (!queue.empty()) {
-        auto item = queue.top();
-        queue.pop();
-        if (unified_targets.empty() || unified_targets.back() != *(item.first)) {
-            unified_targets.push_back(*(item.first));
-        }
-        if (++item.first != item.second) { queue.emplace(item); }
-    }
-
-    return unified_targets;
+    return unify_targets_of(get_current());
 }
 
 bool SynchronizedExistentialSymbolPostIterator::synchronize_with(const Symbol sync_symbol) {
@@ -730,3 +883,138 @@ bool SynchronizedExistentialSymbolPostIterator::synchronize_with(const Symbol sy
 bool SynchronizedExistentialSymbolPostIterator::synchronize_with(const SymbolPost& sync) {
     return synchronize_with(sync.symbol);
 }
+
+FrozenDelta Delta::freeze() const { return FrozenDelta{ *this }; }
+
+FrozenStatePost::const_iterator FrozenStatePost::find(const Symbol symbol) const {
+    const auto symbol_post_it{ std::lower_bound(begin(), end(), FrozenSymbolPost{ symbol, {} }) };
+    if (symbol_post_it == end() || symbol_post_it->symbol != symbol) { return end(); }
+    return symbol_post_it;
+}
+
+FrozenStatePost::const_iterator FrozenStatePost::first_epsilon_it(const Symbol first_epsilon) const {
+    // Epsilon symbol posts are the last ones, search from the back.
+    auto it{ end() };
+    while (it != begin() && (it - 1)->symbol >= first_epsilon) { --it; }
+    return it;
+}
+
+FrozenDelta::FrozenDelta(const Delta& delta) {
+    const size_t num_of_states{ delta.num_of_states() };
+    size_t num_of_symbol_posts{ 0 };
+    size_t num_of_targets{ 0 };
+    for (const StatePost& state_post: delta) {
+        num_of_symbol_posts += state_post.size();
+        for (const SymbolPost& symbol_post: state_post) { num_of_targets += symbol_post.num_of_targets(); }
+    }
+
+    state_offsets_.reserve(num_of_states + 1);
+    symbol_posts_.reserve(num_of_symbol_posts);
+    targets_.reserve(num_of_targets);
+    for (const StatePost& state_post: delta) {
+        for (const SymbolPost& symbol_post: state_post) {
+            const size_t targets_offset{ targets_.size() };
+            targets_.insert(targets_.end(), symbol_post.targets.begin(), symbol_post.targets.end());
+            // Targets are reserved up-front, the views into them stay valid.
+            symbol_posts_.push_back({ symbol_post.symbol, { targets_.data() + targets_offset, targets_.size() - targets_offset } });
+        }
+        state_offsets_.push_back(symbol_posts_.size());
+    }
+}
+
+FrozenDelta::FrozenDelta(const FrozenDelta& other)
+    : state_offsets_{ other.state_offsets_ }, symbol_posts_{ other.symbol_posts_ }, targets_{ other.targets_ } {
+    // Views of the copied symbol posts still point to the targets of @p other.
+    for (FrozenSymbolPost& symbol_post: symbol_posts_) {
+        const auto targets_offset{ symbol_post.targets.data() - other.targets_.data() };
+        symbol_post.targets = { targets_.data() + targets_offset, symbol_post.targets.size() };
+    }
+}
+
+FrozenDelta& FrozenDelta::operator=(const FrozenDelta& other) {
+    if (this != &other) { *this = FrozenDelta{ other }; }
+    return *this;
+}
+
+bool FrozenDelta::contains(const State source, const Symbol symbol, const State target) const {
+    const FrozenStatePost state_post{ this->state_post(source) };
+    const auto symbol_post_it{ state_post.find(symbol) };
+    if (symbol_post_it == state_post.end()) { return false; }
+    return std::binary_search(symbol_post_it->targets.begin(), symbol_post_it->targets.end(), target);
+}
+
+Delta FrozenDelta::thaw() const {
+    Delta delta(num_of_states());
+    for (State source{ 0 }; source < num_of_states(); ++source) {
+        StatePost& state_post{ delta.mutable_state_post(source) };
+        state_post.reserve(this->state_post(source).size());
+        for (const FrozenSymbolPost& symbol_post: this->state_post(source)) {
+            SymbolPost& thawed_symbol_post{ state_post.emplace_back(symbol_post.symbol) };
+            thawed_symbol_post.targets.reserve(symbol_post.num_of_targets());
+            for (const State target: symbol_post.targets) { thawed_symbol_post.targets.push_back(target); }
+        }
+    }
+    return delta;
+}
+
+PredecessorIndex::PredecessorIndex(const Delta& delta) {
+    const size_t num_of_states{ delta.num_of_states() };
+
+    // Counting sort of the reversed moves (symbol, source) by their targets.
+    std::vector<size_t> move_offsets(num_of_states + 1, 0);
+    for (const StatePost& state_post: delta) {
+        for (const SymbolPost& symbol_post: state_post) {
+            for (const State target: symbol_post.targets) { ++move_offsets[target + 1]; }
+        }
+    }
+    std::partial_sum(move_offsets.begin(), move_offsets.end(), move_offsets.begin());
+    std::vector<std::pair<Symbol, State>> reversed_moves(move_offsets.back());
+    {
+        std::vector<size_t> next_move_index(move_offsets.begin(), move_offsets.end() - 1);
+        for (State source{ 0 }; source < num_of_states; ++source) {
+            for (const SymbolPost& symbol_post: delta[source]) {
+                for (const State target: symbol_post.targets) {
+                    reversed_moves[next_move_index[target]++] = { symbol_post.symbol, source };
+                }
+            }
+        }
+    }
+
+    state_offsets_.reserve(num_of_states + 1);
+    // Sources are reserved up-front, the views into them stay valid.
+    targets_.reserve(reversed_moves.size());
+    for (State target{ 0 }; target < num_of_states; ++target) {
+        const auto moves_end{ reversed_moves.begin() + static_cast<long>(move_offsets[target + 1]) };
+        auto moves_it{ reversed_moves.begin() + static_cast<long>(move_offsets[target]) };
+        std::sort(moves_it, moves_end);
+        while (moves_it != moves_end) {
+            const Symbol symbol{ moves_it->first };
+            const size_t sources_offset{ targets_.size() };
+            for (; moves_it != moves_end && moves_it->first == symbol; ++moves_it) { targets_.push_back(moves_it->second); }
+            symbol_posts_.push_back({ symbol, { targets_.data() + sources_offset, targets_.size() - sources_offset } });
+        }
+        state_offsets_.push_back(symbol_posts_.size());
+    }
+}
+
+std::span<const State> PredecessorIndex::pre(const State state, const Symbol symbol) const {
+    const FrozenStatePost symbol_posts{ state_post(state) };
+    const auto symbol_post_it{ symbol_posts.find(symbol) };
+    if (symbol_post_it == symbol_posts.end()) { return {}; }
+    return symbol_post_it->targets;
+}
+
+StateSet SynchronizedExistentialFrozenSymbolPostIterator::unify_targets() const {
+    if(!is_synchronized()) { return {}; }
+    return unify_targets_of(get_current());
+}
+
+bool SynchronizedExistentialFrozenSymbolPostIterator::synchronize_with(const Symbol sync_symbol) {
+    do {
+        if (is_synchronized()) {
+            auto current_min_symbol_post_it = get_current_minimum();
+            if (current_min_symbol_post_it->symbol >= sync_symbol) { break; }
+        }
+    } while (advance());
+    return is_synchronized() && get_current_minimum()->symbol == sync_symbol;
+}
@@ -5,9 +5,19 @@
 #include "mata/nfa/nfa.hh"
 #include "mata/nfa/algorithms.hh"
 #include "mata/utils/sparse-set.hh"
+#include "mata/utils/adaptive-set.hh"
+#include "mata/utils/antichain.hh"
+#include "mata/utils/work-stealing-queues.hh"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 using namespace mata::nfa;
 using namespace mata::utils;
+using mata::Symbol;
 
 /// naive language inclusion check (complementation + intersection + emptiness)
 bool mata::nfa::algorithms::is_included_naive(
@@ -39,92 +49,132 @@ bool mata::nfa::algorithms::is_included_naive(
 } // is_included_naive }}}
 
 
-/// language inclusion check using Antichains
+namespace {
+/// language inclusion check using Antichains over automata of type @p Automaton (either @c Nfa or @c FrozenNfa) and
+///  macrostates of type @p Macrostate (either @c StateSet or @c AdaptiveSet)
+/// If @p simulation is given, it is a forward simulation over the union of both automata where the states of @p bigger
+///  are shifted behind the states of @p smaller. It is then used to minimize macrostates, to strengthen the
+///  subsumption and to accept pairs (p, P) where p is simulated by a state of P early (Abdulla et al., When Simulation
+///  Meets Antichains, TACAS'10).
 // TODO, what about to construct the separator from this?
-bool mata::nfa::algorithms::is_included_antichains(
-    const Nfa&             smaller,
-    const Nfa&             bigger,
-    const Alphabet* const  alphabet, //TODO: this parameter is not used
-    Run*                   cex)
+template<class Automaton, class Macrostate = StateSet>
+bool antichains_inclusion(
+    const Automaton&                    smaller,
+    const Automaton&                    bigger,
+    Run*                                cex,
+    const Simlib::Util::BinaryRelation* simulation = nullptr)
 { // {{{
-    (void)alphabet;
-
     // TODO: Decide what is the best optimization for inclusion.
 
-    using ProdStateType = std::tuple<State, StateSet, size_t>;
-    using ProdStatesType = std::vector<ProdStateType>;
-    // ProcessedType is indexed by states of the smaller nfa
-    // tailored for pure antichain approach ... the simulation-based antichain will not work (without changes).
-    using ProcessedType = std::vector<ProdStatesType>;
+    const size_t bigger_offset{ smaller.num_of_states() };
+    // Is the state 'rhs' of bigger simulating the state 'lhs' of bigger?
+    auto bigger_simulated = [&](const State lhs, const State rhs) {
+        return simulation->get(lhs + bigger_offset, rhs + bigger_offset);
+    };
+    // Is each state of 'lhs' simulated by some state of 'rhs'?
+    auto is_simulated = [&](const Macrostate& lhs, const Macrostate& rhs) {
+        return std::all_of(lhs.begin(), lhs.end(), [&](const State x) {
+            return std::any_of(rhs.begin(), rhs.end(), [&](const State y) { return bigger_simulated(x, y); });
+        });
+    };
 
-    auto subsumes = [](const ProdStateType& lhs, const ProdStateType& rhs) {
-        if (std::get<0>(lhs) != std::get<0>(rhs)) {
-            return false;
+    // With a simulation, pairs with a state p of smaller are subsumed by pairs with states simulating p, and a pair
+    //  with p subsumes pairs with states simulated by p.
+    std::vector<std::vector<State>> smaller_simulating{};
+    std::vector<std::vector<State>> smaller_simulated{};
+    if (simulation != nullptr) {
+        smaller_simulating.resize(smaller.num_of_states());
+        smaller_simulated.resize(smaller.num_of_states());
+        for (State p{ 0 }; p < smaller.num_of_states(); ++p) {
+            for (State r{ 0 }; r < smaller.num_of_states(); ++r) {
+                if (simulation->get(p, r)) { smaller_simulating[p].push_back(r); }
+                if (simulation->get(r, p)) { smaller_simulated[p].push_back(r); }
+            }
         }
+    }
 
-        const StateSet& lhs_bigger = std::get<1>(lhs);
-        const StateSet& rhs_bigger = std::get<1>(rhs);
+    // Pairs (q,S) discovered so far. A pair is identified by its index, the pairs keep the links to the pairs they were
+    //  discovered from for counterexamples ('parent == index' for the initial pairs).
+    struct Node {
+        State smaller_state;
+        size_t parent;
+        Symbol symbol;
+    };
+    std::vector<Node> nodes{};
+    // Pairs removed from the antichain as subsumed are skipped when popped from the worklist.
+    std::vector<bool> is_alive{};
+    auto mark_erased = [&](const size_t node) { is_alive[node] = false; };
+
+    // Antichain of the processed pairs, indexed by states of the smaller nfa.
+    std::vector<Antichain<Macrostate>> processed(smaller.num_of_states());
+    // Pairs (q,S) to be processed.
+    std::vector<std::pair<size_t, Macrostate>> worklist{};
+
+    // Is the pair (p, P) subsumed by a processed pair (r, R): r == p and R is a subset of P, or, with a simulation,
+    //  r simulates p and each state of R is simulated by a state of P?
+    auto is_subsumed = [&](const State smaller_state, const Macrostate& bigger_set) {
+        if (simulation == nullptr) { return processed[smaller_state].contains_subset_of(bigger_set); }
+        return std::any_of(smaller_simulating[smaller_state].begin(), smaller_simulating[smaller_state].end(),
+                           [&](const State simulating) {
+            return processed[simulating].any_of([&](const Macrostate& processed_set, size_t) {
+                return is_simulated(processed_set, bigger_set);
+            });
+        });
+    };
 
-        //TODO: Can this be done faster using more heuristics? E.g., compare the last elements first ...
-        //TODO: Try BDDs! What about some abstractions?
-        return lhs_bigger.is_subset_of(rhs_bigger);
+    // Remove processed pairs subsumed by the pair (p, P) from the antichain and from the worklist.
+    auto erase_subsumed = [&](const State smaller_state, const Macrostate& bigger_set) {
+        if (simulation == nullptr) {
+            processed[smaller_state].erase_supersets_of(bigger_set, mark_erased);
+            return;
+        }
+        for (const State simulated: smaller_simulated[smaller_state]) {
+            processed[simulated].erase_if([&](const Macrostate& processed_set, size_t) {
+                return is_simulated(bigger_set, processed_set);
+            }, mark_erased);
+        }
     };
 
+    auto insert = [&](const State smaller_state, Macrostate bigger_set, const size_t parent, const Symbol symbol) {
+        const size_t node{ nodes.size() };
+        nodes.push_back({ smaller_state, parent == Limits::max_state ? node : parent, symbol });
+        is_alive.push_back(true);
+        processed[smaller_state].insert(bigger_set, node);
+        worklist.emplace_back(node, std::move(bigger_set));
+    };
 
-    // initialize
-    ProdStatesType worklist{};//Pairs (q,S) to be processed. It sometimes gives a huge speed-up when they are kept sorted by the size of S,
-    // worklist.reserve(32);
-    // so those with smaller popped for processing first.
-    ProcessedType processed(smaller.num_of_states()); // Allocate to the number of states of the smaller nfa.
-    // The pairs of each state are also kept sorted. It allows slightly faster antichain pruning - no need to test inclusion in sets that have less elements.
+    // Remove states of the macrostate simulated by other states of the macrostate (keeping a single state of each
+    //  class of simulation-equivalent states). The language of the macrostate does not change.
+    auto minimize = [&](Macrostate& macrostate) {
+        if (simulation == nullptr || macrostate.size() < 2) { return; }
+        StateSet kept{};
+        for (const State x: macrostate) {
+            if (std::none_of(macrostate.begin(), macrostate.end(), [&](const State y) {
+                return x != y && bigger_simulated(x, y) && (!bigger_simulated(y, x) || y < x);
+            })) { kept.push_back(x); }
+        }
+        if (kept.size() != macrostate.size()) { macrostate = Macrostate{ kept }; }
+    };
 
-    //Is |S| < |S'| for the inut pairs (q,S) and (q',S')?
-    // auto smaller_set = [](const ProdStateType & a, const ProdStateType & b) { return std::get<1>(a).size() < std::get<1>(b).size(); };
+    // Is the language of the state of smaller included in the language of a state of the macrostate?
+    auto is_accepted_early = [&](const State smaller_state, const Macrostate& macrostate) {
+        return simulation != nullptr && std::any_of(macrostate.begin(), macrostate.end(), [&](const State y) {
+            return simulation->get(smaller_state, y + bigger_offset);
+        });
+    };
 
     std::vector<State> distances_smaller = smaller.distances_to_final();
     std::vector<State> distances_bigger = bigger.distances_to_final();
 
-    // auto closer_dist = [&](const ProdStateType & a, const ProdStateType & b) {
-    //     return distances_smaller[a.first] < distances_smaller[b.first];
-    // };
-
-    // auto closer_smaller = [&](const ProdStateType & a, const ProdStateType & b) {
-    //     if (distances_smaller[a.first] != distances_smaller[b.first])
-    //         return distances_smaller[a.first] < distances_smaller[b.first];
-    //     else
-    //         return a.second.size() < b.second.size();
-    // };
-
-    // auto smaller_closer = [&](const ProdStateType & a, const ProdStateType & b) {
-    //     if (a.second.size() != b.second.size())
-    //         return a.second.size() < b.second.size();
-    //     else
-    //         return distances_smaller[a.first] < distances_smaller[b.first];
-    // };
-
-    auto min_dst = [&](const StateSet& set) {
+    auto min_dst = [&](const Macrostate& set) {
         if (set.empty()) return Limits::max_state;
         return distances_bigger[*std::min_element(set.begin(), set.end(), [&](const State a,const State b){return distances_bigger[a] < distances_bigger[b];})];
     };
 
-    auto lengths_incompatible = [&](const ProdStateType& pair) {
-        return distances_smaller[std::get<0>(pair)] < std::get<2>(pair);
-    };
-
-    auto insert_to_pairs = [&](ProdStatesType & pairs,const ProdStateType & pair) {
-        // auto it = std::lower_bound(pairs.begin(), pairs.end(), pair, smaller_set);
-        // auto it = std::lower_bound(pairs.begin(), pairs.end(), pair, closer_dist);
-        // auto it = std::lower_bound(pairs.begin(), pairs.end(), pair, smaller_closer);
-        // auto it = std::lower_bound(pairs.begin(), pairs.end(), pair, closer_smaller);
-        // pairs.insert(it,pair);
-        pairs.push_back(pair);
-        // std::sort(pairs.begin(), pairs.end(), smaller_closer);
+    auto lengths_incompatible = [&](const State smaller_state, const Macrostate& bigger_set) {
+        return distances_smaller[smaller_state] < min_dst(bigger_set);
     };
 
-    // 'paths[s] == t' denotes that state 's' was accessed from state 't',
-    // 'paths[s] == s' means that 's' is an initial state
-    std::map<ProdStateType, std::pair<ProdStateType, Symbol>> paths;
-
     // check initial states first // TODO: this would be done in the main loop as the first thing anyway?
     for (const auto& state : smaller.initial) {
         if (smaller.final[state] &&
@@ -134,26 +184,25 @@ bool mata::nfa::algorithms::is_included_antichains(
             return false;
         }
 
-        StateSet bigger_state_set{ bigger.initial };
-        const ProdStateType st = std::tuple(state, bigger_state_set, min_dst(bigger_state_set));
-        insert_to_pairs(worklist, st);
-        insert_to_pairs(processed[state],st);
-
-        if (cex != nullptr)
-            paths.insert({ st, {st, 0}});
+        Macrostate bigger_state_set{ StateSet{ bigger.initial } };
+        minimize(bigger_state_set);
+        if (is_accepted_early(state, bigger_state_set)) { continue; }
+        insert(state, std::move(bigger_state_set), Limits::max_state, 0);
     }
 
     //For synchronised iteration over the set of states
-    SynchronizedExistentialSymbolPostIterator sync_iterator;
+    SynchronizedExistentialSymbolPostIteratorOf<decltype(bigger.delta)> sync_iterator;
+    // Collects the targets of adaptive macrostates in a bitset instead of merging the sorted target sets.
+    [[maybe_unused]] typename AdaptiveSet<State>::Builder builder{ bigger.num_of_states() };
 
     // We use DFS strategy for the worklist processing
     while (!worklist.empty()) {
         // get a next product state
-        ProdStateType prod_state = *worklist.rbegin();
+        const auto [node, bigger_set] = std::move(worklist.back());
         worklist.pop_back();
+        if (!is_alive[node]) { continue; }
 
-        const State& smaller_state = std::get<0>(prod_state);
-        const StateSet& bigger_set = std::get<1>(prod_state);
+        const State smaller_state{ nodes[node].smaller_state };
 
         sync_iterator.reset();
         for (State q: bigger_set) {
@@ -164,26 +213,34 @@ bool mata::nfa::algorithms::is_included_antichains(
         for (const auto& smaller_move : smaller.delta[smaller_state]) {
             const Symbol& smaller_symbol = smaller_move.symbol;
 
-            StateSet bigger_succ = {};
+            Macrostate bigger_succ = {};
             if(sync_iterator.synchronize_with(smaller_move)) {
-                bigger_succ = sync_iterator.unify_targets();
+                if constexpr (std::is_same_v<Macrostate, StateSet>) {
+                    bigger_succ = sync_iterator.unify_targets();
+                } else {
+                    for (const auto& symbol_post: sync_iterator.get_current()) { builder.insert(symbol_post->targets); }
+                    bigger_succ = builder.build();
+                }
             }
 
+            minimize(bigger_succ);
+
             for (const State& smaller_succ : smaller_move.targets) {
-                const ProdStateType succ = {smaller_succ, bigger_succ, min_dst(bigger_succ)};
+                if (is_accepted_early(smaller_succ, bigger_succ)) { continue; }
 
-                if (lengths_incompatible(succ) ||
-                    (smaller.final[smaller_succ] && !bigger.final.intersects_with(bigger_succ)))
+                if (lengths_incompatible(smaller_succ, bigger_succ) ||
+                    (smaller.final[smaller_succ] && std::none_of(bigger_succ.begin(), bigger_succ.end(),
+                                                                 [&](const State q) { return bigger.final[q]; })))
                 {
                     if (cex != nullptr) {
+                        cex->word.clear();
+                        cex->path.clear();
                         cex->word.push_back(smaller_symbol);
                         cex->path.push_back(smaller_state);
-                        auto next_on_path = paths.find(prod_state);
-                        while (next_on_path->second.first != next_on_path->first)
+                        for (size_t on_path{ node }; nodes[on_path].parent != on_path; on_path = nodes[on_path].parent)
                         { // go back until initial state
-                            cex->word.push_back(next_on_path->second.second);
-                            cex->path.push_back(std::get<0>(next_on_path->second.first));
-                            next_on_path = paths.find(next_on_path->second.first);
+                            cex->word.push_back(nodes[on_path].symbol);
+                            cex->path.push_back(nodes[nodes[on_path].parent].smaller_state);
                         }
 
                         std::reverse(cex->word.begin(), cex->word.end());
@@ -198,50 +255,409 @@ bool mata::nfa::algorithms::is_included_antichains(
                     return false;
                 }
 
-                bool is_subsumed = false;
-                for (const auto& anti_state : processed[smaller_succ])
-                { // trying to find in processed a smaller state than the newly created succ
-                    // if (smaller_set(succ,anti_state)) {
-                    //     break;
-                    // }
-                    if (subsumes(anti_state, succ)) {
-                        is_subsumed = true;
-                        break;
-                    }
+                // trying to find in processed a smaller state than the newly created succ
+                if (is_subsumed(smaller_succ, bigger_succ)) {
+                    continue;
                 }
 
-                if (is_subsumed) {
+                //Pruning of processed and the worklist.
+                erase_subsumed(smaller_succ, bigger_succ);
+                insert(smaller_succ, bigger_succ, node, smaller_symbol);
+            }
+        }
+    }
+    return true;
+} // }}}
+} // namespace
+
+bool mata::nfa::algorithms::is_included_antichains(
+    const Nfa&             smaller,
+    const Nfa&             bigger,
+    const Alphabet* const  alphabet, //TODO: this parameter is not used
+    Run*                   cex)
+{ // {{{
+    (void)alphabet;
+    return antichains_inclusion(smaller, bigger, cex);
+} // }}}
+
+bool mata::nfa::algorithms::is_included_antichains(
+    const FrozenNfa&       smaller,
+    const FrozenNfa&       bigger,
+    const Alphabet* const  alphabet, //TODO: this parameter is not used
+    Run*                   cex)
+{ // {{{
+    (void)alphabet;
+    return antichains_inclusion(smaller, bigger, cex);
+} // }}}
+
+namespace {
+/**
+ * Language inclusion check using Antichains run by @p num_of_threads threads.
+ *
+ * Threads pop pairs (q,S) from @c WorkStealingQueues and push the pairs they discover to their own queues. The
+ *  antichain of processed pairs is split by states of @p smaller, each part guarded by its own mutex, so that the
+ *  subsumption check, the pruning and the insertion of a pair are atomic. Pairs pruned from the antichain are marked
+ *  and skipped when popped. The first thread which finds a counterexample stores it and cancels the others.
+ */
+bool parallel_antichains_inclusion(const Nfa& smaller, const Nfa& bigger, const size_t num_of_threads, Run* cex) {
+    /// A pair (q,S) with the link to the pair it was discovered from for counterexamples.
+    struct Node {
+        State smaller_state;
+        Symbol symbol;
+        const Node* parent; ///< Null for the initial pairs.
+        std::atomic<bool> is_alive{ true };
+    };
+    struct Task {
+        Node* node;
+        StateSet bigger_set;
+    };
+    /// Antichain of the processed pairs with a single state of smaller.
+    struct alignas(64) Part {
+        std::mutex mutex{};
+        Antichain<StateSet, Node*> antichain{};
+    };
+
+    const std::vector<State> distances_smaller = smaller.distances_to_final();
+    const std::vector<State> distances_bigger = bigger.distances_to_final();
+    auto min_dst = [&](const StateSet& set) {
+        if (set.empty()) return Limits::max_state;
+        return distances_bigger[*std::min_element(set.begin(), set.end(), [&](const State a,const State b){return distances_bigger[a] < distances_bigger[b];})];
+    };
+
+    std::vector<Part> processed(smaller.num_of_states());
+    WorkStealingQueues<Task> queues{ num_of_threads };
+    // Nodes created by each thread. Nodes are never removed, so that they can be referenced by pointers.
+    std::vector<std::deque<Node>> nodes(num_of_threads);
+
+    // Insert the pair (p, P) found by @p thread to the antichain unless it is subsumed.
+    // Returns the node of the inserted pair, or null if the pair is subsumed.
+    auto insert = [&](const size_t thread, const State smaller_state, const StateSet& bigger_set, const Symbol symbol,
+                      const Node* parent) -> Node* {
+        Part& part{ processed[smaller_state] };
+        const std::lock_guard lock{ part.mutex };
+        if (part.antichain.contains_subset_of(bigger_set)) { return nullptr; }
+        part.antichain.erase_supersets_of(bigger_set, [](Node* node) {
+            node->is_alive.store(false, std::memory_order_relaxed);
+        });
+        Node* node{ &nodes[thread].emplace_back(smaller_state, symbol, parent) };
+        part.antichain.insert(bigger_set, node);
+        return node;
+    };
+
+    // check initial states first
+    const StateSet bigger_initial{ bigger.initial };
+    for (const State state: smaller.initial) {
+        if (smaller.final[state] && are_disjoint(bigger.initial, bigger.final)) {
+            if (cex != nullptr) { cex->word.clear(); cex->path = { state }; }
+            return false;
+        }
+        queues.push(0, Task{ insert(0, state, bigger_initial, 0, nullptr), bigger_initial });
+    }
+
+    std::mutex cex_mutex{};
+    bool is_cex_found{ false };
+    std::vector<std::exception_ptr> exceptions(num_of_threads);
+    auto explore = [&](const size_t thread) {
+        //For synchronised iteration over the set of states
+        SynchronizedExistentialSymbolPostIteratorOf<Delta> sync_iterator;
+        try {
+            while (std::optional<Task> task{ queues.pop(thread) }) {
+                if (!task->node->is_alive.load(std::memory_order_relaxed)) {
+                    queues.task_done();
                     continue;
                 }
+                const State smaller_state{ task->node->smaller_state };
+                sync_iterator.reset();
+                for (const State q: task->bigger_set) { mata::utils::push_back(sync_iterator, bigger.delta[q]); }
+
+                for (const SymbolPost& smaller_move: smaller.delta[smaller_state]) {
+                    StateSet bigger_succ{};
+                    if (sync_iterator.synchronize_with(smaller_move)) { bigger_succ = sync_iterator.unify_targets(); }
+
+                    for (const State smaller_succ: smaller_move.targets) {
+                        if (distances_smaller[smaller_succ] < min_dst(bigger_succ) ||
+                            (smaller.final[smaller_succ] && std::none_of(bigger_succ.begin(), bigger_succ.end(),
+                                                                         [&](const State q) { return bigger.final[q]; })))
+                        {
+                            const std::lock_guard lock{ cex_mutex };
+                            if (!is_cex_found && cex != nullptr) {
+                                cex->word = { smaller_move.symbol };
+                                cex->path = { smaller_state };
+                                for (const Node* on_path{ task->node }; on_path->parent != nullptr;
+                                     on_path = on_path->parent) {
+                                    cex->word.push_back(on_path->symbol);
+                                    cex->path.push_back(on_path->parent->smaller_state);
+                                }
+                                std::reverse(cex->word.begin(), cex->word.end());
+                                std::reverse(cex->path.begin(), cex->path.end());
+                                Run leftover = smaller.get_shortest_accepting_run_from_state(smaller_succ,
+                                                                                             distances_smaller);
+                                cex->word.insert(cex->word.end(), leftover.word.begin(), leftover.word.end());
+                                cex->path.insert(cex->path.end(), leftover.path.begin(), leftover.path.end());
+                            }
+                            is_cex_found = true;
+                            queues.cancel();
+                            return;
+                        }
 
-                for (ProdStatesType* ds: {&processed[smaller_succ], &worklist}) {
-                    //Pruning of processed and the worklist.
-                    //Since they are ordered by the size of the sets, we can iterate from back,
-                    //and as soon as we get to sets larger than succ, we can stop (larger sets cannot be subsets).
-                    std::erase_if(*ds, [&](const auto& d){ return subsumes(succ, d); });
-                    // for (long it = static_cast<long>(ds->size()-1);it>=0;--it) {
-                    //     // if (smaller_set((*ds)[static_cast<size_t>(it)],succ))
-                    //         // break;
-                    //     if (subsumes(succ, (*ds)[static_cast<size_t>(it)])) {
-                    //         //Using index it instead of an iterator since erase could invalidate it (?)
-                    //         ds->erase(ds->begin() + it);
-                    //     }
-                    // }
-                    insert_to_pairs(*ds, succ);
+                        if (Node* node{ insert(thread, smaller_succ, bigger_succ, smaller_move.symbol, task->node) }) {
+                            queues.push(thread, Task{ node, bigger_succ });
+                        }
+                    }
                 }
+                queues.task_done();
+            }
+        } catch (...) {
+            exceptions[thread] = std::current_exception();
+            queues.cancel();
+        }
+    };
+    {
+        std::vector<std::jthread> workers{};
+        workers.reserve(num_of_threads - 1);
+        for (size_t thread{ 1 }; thread < num_of_threads; ++thread) { workers.emplace_back(explore, thread); }
+        explore(0);
+    } // Joins the workers.
+    for (const std::exception_ptr& exception: exceptions) {
+        if (exception) { std::rethrow_exception(exception); }
+    }
+    return !is_cex_found;
+}
+} // namespace
+
+bool mata::nfa::algorithms::is_included_antichains_parallel(
+    const Nfa& smaller, const Nfa& bigger, const size_t num_of_threads, Run* cex) {
+    if (num_of_threads <= 1) { return antichains_inclusion(smaller, bigger, cex); }
+    return parallel_antichains_inclusion(smaller, bigger, num_of_threads, cex);
+}
+
+bool mata::nfa::algorithms::is_included_antichains_sim(
+    const Nfa&             smaller,
+    const Nfa&             bigger,
+    const Alphabet* const  alphabet, //TODO: this parameter is not used
+    Run*                   cex)
+{ // {{{
+    (void)alphabet;
+    // Forward simulation over the union of both automata, with the states of bigger behind the states of smaller.
+    const size_t smaller_num_of_states{ smaller.num_of_states() };
+    Delta united{ smaller.delta };
+    united.allocate(smaller_num_of_states);
+    united.append(bigger.delta.renumber_targets([&](const State st) { return st + smaller_num_of_states; }));
+    SparseSet<State> united_final{ smaller.final };
+    for (const State state: bigger.final) { united_final.insert(state + smaller_num_of_states); }
+    const Simlib::Util::BinaryRelation simulation{
+        compute_direct_simulation(united, smaller_num_of_states + bigger.num_of_states(), united_final) };
+    return antichains_inclusion(smaller, bigger, cex, &simulation);
+} // }}}
+
+namespace {
+/// Pairs of macrostates and their congruence closure, the smallest equivalence containing the pairs and closed under
+///  union. A pair (X, Y) is in the closure iff X and Y have the same normal form, the biggest set reachable by
+///  rewriting rules Z -> Z + Y for X included in Z and Z -> Z + X for Y included in Z. With a simulation, the closure is
+///  also closed under similarity: states simulated by a state of Z are added to Z.
+class CongruenceClosure {
+public:
+    explicit CongruenceClosure(const size_t num_of_states, std::vector<std::vector<State>> simulated = {})
+        : occurrences_(num_of_states), simulated_{ std::move(simulated) }, marks_(num_of_states, 0) {}
+
+    /// Add a pair (@p lhs, @p rhs).
+    /// @return Index of the pair.
+    size_t add(StateSet lhs, StateSet rhs) {
+        const size_t pair{ is_active_.size() };
+        for (StateSet* side: { &lhs, &rhs }) {
+            const size_t side_index{ sides_.size() };
+            if (side->empty()) { empty_sides_.push_back(side_index); }
+            for (const State state: *side) { occurrences_[state].push_back(side_index); }
+            sides_.push_back(std::move(*side));
+        }
+        is_active_.push_back(true);
+        return pair;
+    }
+
+    /// Stop using the pair @p pair for rewriting.
+    void remove(const size_t pair) { is_active_[pair] = false; }
+
+    const StateSet& lhs(const size_t pair) const { return sides_[2 * pair]; }
+    const StateSet& rhs(const size_t pair) const { return sides_[2 * pair + 1]; }
+
+    /// Is the pair @p pair in the congruence closure of the other active pairs?
+    bool is_redundant(const size_t pair) {
+        is_active_[pair] = false;
+        const bool redundant{ rewrites_to(lhs(pair), rhs(pair)) && rewrites_to(rhs(pair), lhs(pair)) };
+        is_active_[pair] = true;
+        return redundant;
+    }
 
-                if(cex != nullptr) {
-                    // also set that succ was accessed from state
-                    paths[succ] = {prod_state, smaller_symbol};
+private:
+    std::vector<StateSet> sides_{}; ///< Sides of pairs: 2 * pair for the left side, 2 * pair + 1 for the right side.
+    std::vector<bool> is_active_{};
+    std::vector<std::vector<size_t>> occurrences_; ///< Sides containing each state.
+    std::vector<size_t> empty_sides_{};
+    std::vector<std::vector<State>> simulated_; ///< States simulated by each state (empty without similarity).
+    /// Number of states of each side not in the set being rewritten, valid for the current generation only.
+    std::vector<size_t> missing_{};
+    std::vector<size_t> missing_generation_{};
+    std::vector<size_t> marks_; ///< States with the current generation are in the set being rewritten.
+    size_t generation_{ 0 };
+    std::vector<State> to_process_{};
+
+    /// Is @p to included in the normal form of @p from? The rewriting stops as soon as it is.
+    bool rewrites_to(const StateSet& from, const StateSet& to) {
+        ++generation_;
+        missing_.resize(sides_.size());
+        missing_generation_.resize(sides_.size(), 0);
+        size_t num_of_missing{ to.size() };
+        to_process_.clear();
+        auto mark = [&](const State state) {
+            if (marks_[state] == generation_) { return; }
+            marks_[state] = generation_;
+            to_process_.push_back(state);
+            if (to.contains(state)) { --num_of_missing; }
+        };
+        auto mark_other_side = [&](const size_t side) {
+            if (!is_active_[side / 2]) { return; }
+            for (const State state: sides_[side ^ 1]) { mark(state); }
+        };
+
+        for (const State state: from) { mark(state); }
+        for (const size_t side: empty_sides_) { mark_other_side(side); }
+        while (num_of_missing != 0 && !to_process_.empty()) {
+            const State state{ to_process_.back() };
+            to_process_.pop_back();
+            if (!simulated_.empty()) {
+                for (const State simulated: simulated_[state]) { mark(simulated); }
+            }
+            for (const size_t side: occurrences_[state]) {
+                if (missing_generation_[side] != generation_) {
+                    missing_generation_[side] = generation_;
+                    missing_[side] = sides_[side].size();
                 }
+                if (--missing_[side] == 0) { mark_other_side(side); }
             }
         }
+        return num_of_missing == 0;
+    }
+};
+
+/// Bisimulation up to congruence (Bonchi and Pous, Checking NFA Equivalence with Bisimulations up to Congruence,
+///  POPL'13) over the disjoint union of @p lhs and @p rhs, where the states of @p rhs are shifted behind the states of
+///  @p lhs. Pairs of macrostates are explored in a depth-first order from the pair of initial macrostates; a pair is
+///  skipped if it is in the congruence closure of the pairs explored or waiting to be explored. For inclusion, the
+///  language of a macrostate X is included in the language of Y iff X + Y is equivalent to Y, therefore the pairs
+///  (X + Y, Y) are explored instead. If @p up_to_similarity is set, the closure is computed up to the forward simulation
+///  over the union (HKC' of the paper).
+/// @return True if the languages are equal (included), otherwise false and a counterexample word in @p cex.
+bool bisimulation_up_to_congruence(const Nfa& lhs, const Nfa& rhs, const bool inclusion, const bool up_to_similarity,
+                                   Run* cex) { // {{{
+    const size_t lhs_num_of_states{ lhs.num_of_states() };
+    Nfa united{ lhs };
+    united.delta.allocate(lhs_num_of_states);
+    united.delta.append(rhs.delta.renumber_targets([&](const State st) { return st + lhs_num_of_states; }));
+    for (const State state: rhs.final) { united.final.insert(state + lhs_num_of_states); }
+
+    StateSet rhs_initial{};
+    for (const State state: rhs.initial) { rhs_initial.insert(state + lhs_num_of_states); }
+    StateSet lhs_initial{ lhs.initial };
+    if (inclusion) { lhs_initial.insert(rhs_initial); }
+
+    auto is_final = [&](const StateSet& macrostate) {
+        return std::any_of(macrostate.begin(), macrostate.end(), [&](const State q) { return united.final.contains(q); });
+    };
+
+    // The pair reached each pair from (the pair itself for the initial pair) and the symbol it was reached over.
+    std::vector<std::pair<size_t, Symbol>> parents{};
+    auto fail = [&](const size_t pair) {
+        if (cex != nullptr) {
+            cex->word.clear();
+            cex->path.clear();
+            for (size_t i{ pair }; i != 0; i = parents[i].first) { cex->word.push_back(parents[i].second); }
+            std::reverse(cex->word.begin(), cex->word.end());
+        }
+        return false;
+    };
+
+    std::vector<std::vector<State>> simulated{};
+    if (up_to_similarity) {
+        const Simlib::Util::BinaryRelation simulation{
+            algorithms::compute_direct_simulation(united.delta, united.num_of_states(), united.final) };
+        simulated.resize(united.num_of_states());
+        for (State p{ 0 }; p < united.num_of_states(); ++p) {
+            for (State q{ 0 }; q < united.num_of_states(); ++q) {
+                if (p != q && simulation.get(q, p)) { simulated[p].push_back(q); }
+            }
+        }
+    }
+    // Pairs explored (relation R) or waiting to be explored (todo), indexed in the order of their discovery.
+    CongruenceClosure pairs{ united.num_of_states(), std::move(simulated) };
+    parents.emplace_back(pairs.add(lhs_initial, rhs_initial), 0);
+    if (is_final(pairs.lhs(0)) != is_final(pairs.rhs(0))) { return fail(0); }
+
+    std::vector<Symbol> symbols{};
+    // We use DFS strategy for the worklist processing
+    std::vector<size_t> worklist{ 0 };
+    while (!worklist.empty()) {
+        const size_t next{ worklist.back() };
+        worklist.pop_back();
+        if (pairs.is_redundant(next)) {
+            pairs.remove(next);
+            continue;
+        }
+
+        symbols.clear();
+        for (const StateSet* macrostate: { &pairs.lhs(next), &pairs.rhs(next) }) {
+            for (const State q: *macrostate) {
+                for (const SymbolPost& symbol_post: united.delta[q]) { symbols.push_back(symbol_post.symbol); }
+            }
+        }
+        std::sort(symbols.begin(), symbols.end());
+        symbols.erase(std::unique(symbols.begin(), symbols.end()), symbols.end());
+
+        for (const Symbol symbol: symbols) {
+            StateSet lhs_succ{ united.post(pairs.lhs(next), symbol) };
+            StateSet rhs_succ{ united.post(pairs.rhs(next), symbol) };
+            if (lhs_succ == rhs_succ) { continue; }
+            const bool mismatch{ is_final(lhs_succ) != is_final(rhs_succ) };
+            parents.emplace_back(next, symbol);
+            worklist.push_back(pairs.add(std::move(lhs_succ), std::move(rhs_succ)));
+            if (mismatch) { return fail(parents.size() - 1); }
+        }
     }
     return true;
 } // }}}
+} // namespace
+
+bool mata::nfa::algorithms::is_included_hkc(
+    const Nfa&             smaller,
+    const Nfa&             bigger,
+    const Alphabet* const  alphabet, //TODO: this parameter is not used
+    Run*                   cex)
+{ // {{{
+    (void)alphabet;
+    return bisimulation_up_to_congruence(smaller, bigger, true, false, cex);
+} // }}}
+
+bool mata::nfa::algorithms::is_included_hkc_sim(
+    const Nfa&             smaller,
+    const Nfa&             bigger,
+    const Alphabet* const  alphabet, //TODO: this parameter is not used
+    Run*                   cex)
+{ // {{{
+    (void)alphabet;
+    return bisimulation_up_to_congruence(smaller, bigger, true, true, cex);
+} // }}}
+
+bool mata::nfa::algorithms::are_equivalent_hkc(const Nfa& lhs, const Nfa& rhs, Run* cex, const bool up_to_similarity) {
+    return bisimulation_up_to_congruence(lhs, rhs, false, up_to_similarity, cex);
+}
 
 namespace {
-    using AlgoType = decltype(algorithms::is_included_naive)*;
+    bool is_included_antichains_adaptive(const Nfa& smaller, const Nfa& bigger, const mata::Alphabet* const alphabet,
+                                         Run* cex) {
+        (void)alphabet;
+        return antichains_inclusion<Nfa, AdaptiveSet<State>>(smaller, bigger, cex);
+    }
+
+    using AlgoType = std::function<decltype(algorithms::is_included_naive)>;
 
     bool compute_equivalence(const Nfa &lhs, const Nfa &rhs, const mata::Alphabet *const alphabet, const AlgoType &algo) {
         //alphabet should not be needed as input parameter
@@ -261,12 +677,31 @@ namespace {
                                      "received: " + std::to_string(params));
         }
 
-        decltype(algorithms::is_included_naive) *algo;
+        AlgoType algo;
         const std::string &str_algo = params.at("algorithm");
+        const size_t num_of_threads{ algorithms::get_num_of_threads(params) };
+        if (num_of_threads > 1 && ("antichains" != str_algo || algorithms::use_adaptive_macrostates(params))) {
+            throw std::runtime_error(function_name + " supports only \"antichains\" with \"sorted-vector\" "
+                                     "macrostates with more than one thread");
+        }
         if ("naive" == str_algo) {
             algo = algorithms::is_included_naive;
         } else if ("antichains" == str_algo) {
-            algo = algorithms::is_included_antichains;
+            if (algorithms::use_adaptive_macrostates(params)) {
+                algo = is_included_antichains_adaptive;
+            } else if (num_of_threads > 1) {
+                algo = [num_of_threads](const Nfa& smaller, const Nfa& bigger, const mata::Alphabet*, Run* cex) {
+                    return algorithms::is_included_antichains_parallel(smaller, bigger, num_of_threads, cex);
+                };
+            } else {
+                algo = static_cast<decltype(algorithms::is_included_naive)*>(algorithms::is_included_antichains);
+            }
+        } else if ("antichains-sim" == str_algo) {
+            algo = algorithms::is_included_antichains_sim;
+        } else if ("hkc" == str_algo) {
+            algo = algorithms::is_included_hkc;
+        } else if ("hkc-sim" == str_algo) {
+            algo = algorithms::is_included_hkc_sim;
         } else {
             throw std::runtime_error(std::to_string(__func__) +
                                      " received an unknown value of the \"algorithm\" key: " + str_algo);
@@ -293,6 +728,11 @@ bool mata::nfa::are_equivalent(const Nfa& lhs, const Nfa& rhs, const Alphabet *a
     //TODO: add comment on what this is doing, what is __func__ ...
     AlgoType algo{ set_algorithm(std::to_string(__func__), params) };
 
+    if (params.at("algorithm") == "hkc" || params.at("algorithm") == "hkc-sim") {
+        // A single symmetric exploration instead of two inclusion checks.
+        return algorithms::are_equivalent_hkc(lhs, rhs, nullptr, params.at("algorithm") == "hkc-sim");
+    }
+
     if (params.at("algorithm") == "naive") {
         if (alphabet == nullptr) {
             const auto computed_alphabet{create_alphabet(lhs, rhs) };
@@ -66,6 +66,34 @@ namespace {
         }
         return reachable;
     }
+
+    /**
+     * Compute the lengths of the shortest paths from @p start_states over edges given by @p successors.
+     * @return Distances indexed by states, @c Limits::max_state for unreached states.
+     */
+    template<class StartStates, class Successors>
+    std::vector<State> bfs_distances(const size_t num_of_states, const StartStates& start_states,
+                                     const Successors& successors) {
+        std::vector<State> distances(num_of_states + 1, Limits::max_state);
+        std::deque<State> que;
+        for (const State state: start_states) {
+            if (distances[state] == Limits::max_state) {
+                distances[state] = 0;
+                que.push_back(state);
+            }
+        }
+        while (!que.empty()) {
+            const State src{ que.front() };
+            que.pop_front();
+            successors(src, [&](const State target) {
+                if (distances[target] == Limits::max_state) {
+                    distances[target] = distances[src] + 1;
+                    que.push_back(target);
+                }
+            });
+        }
+        return distances;
+    }
 }
 
 void Nfa::remove_epsilon(const Symbol epsilon)
@@ -91,7 +119,41 @@ StateSet Nfa::get_reachable_states() const {
 
 StateSet Nfa::get_terminating_states() const
 {
-    return revert(*this).get_reachable_states();
+    const PredecessorIndex& predecessors{ this->predecessors() };
+    BoolVector terminating(num_of_states(), false);
+    std::vector<State> worklist{};
+    for (const State state: final) {
+        terminating[state] = true;
+        worklist.push_back(state);
+    }
+
+    while (!worklist.empty()) {
+        const State state{ worklist.back() };
+        worklist.pop_back();
+        for (const FrozenSymbolPost& symbol_post: predecessors.pre(state)) {
+            for (const State source: symbol_post.targets) {
+                if (!terminating[source]) {
+                    terminating[source] = true;
+                    worklist.push_back(source);
+                }
+            }
+        }
+    }
+
+    StateSet terminating_states{};
+    for (State state{ 0 }; state < terminating.size(); ++state) {
+        if (terminating[state]) { terminating_states.push_back(state); }
+    }
+    return terminating_states;
+}
+
+const PredecessorIndex& Nfa::predecessors() const {
+    const size_t content_id{ delta.content_id() };
+    if (predecessor_index_ == nullptr || predecessor_index_content_id_ != content_id) {
+        predecessor_index_ = std::make_shared<const PredecessorIndex>(delta);
+        predecessor_index_content_id_ = content_id;
+    }
+    return *predecessor_index_;
 }
 
 std::vector<State> Nfa::distances_from_initial() const {
@@ -121,7 +183,12 @@ std::vector<State> Nfa::distances_from_initial() const {
 }
 
 std::vector<State> Nfa::distances_to_final() const {
-    return revert(*this).distances_from_initial();
+    const PredecessorIndex& predecessors{ this->predecessors() };
+    return bfs_distances(num_of_states(), final, [&](const State src, const auto& visit) {
+        for (const FrozenSymbolPost& symbol_post: predecessors.pre(src)) {
+            for (const State source: symbol_post.targets) { visit(source); }
+        }
+    });
 }
 
 Run Nfa::get_shortest_accepting_run_from_state(State q, const std::vector<State>& distances_to_final) const {
@@ -510,11 +577,11 @@ void Nfa::print_to_mata(std::ostream &output, const Alphabet* alphabet) const {
         output << std::endl;
     }
 
-    for (const Transition& trans: delta.transitions()) {
-        output << "q" << trans.source << " "
-        << ((alphabet != nullptr) ? alphabet->reverse_translate_symbol(trans.symbol) : std::to_string(trans.symbol))
-        << " q" << trans.target << std::endl;
-    }
+    delta.for_each_transition([&](const State source, const Symbol symbol, const State target) {
+        output << "q" << source << " "
+        << ((alphabet != nullptr) ? alphabet->reverse_translate_symbol(symbol) : std::to_string(symbol))
+        << " q" << target << std::endl;
+    });
 }
 
 void Nfa::print_to_mata(const std::string& filename, const Alphabet* alphabet) const {
@@ -528,11 +595,11 @@ void Nfa::print_to_mata(const std::string& filename, const Alphabet* alphabet) c
 Nfa Nfa::get_one_letter_aut(Symbol abstract_symbol) const {
     Nfa digraph{num_of_states(), initial, final };
     // Add directed transitions for digraph.
-    for (const Transition& transition: delta.transitions()) {
+    delta.for_each_transition([&](const State source, Symbol, const State target) {
         // Directly try to add the transition. Finding out whether the transition is already in the digraph
         //  only iterates through transition relation again.
-        digraph.delta.add(transition.source, abstract_symbol, transition.target);
-    }
+        digraph.delta.add(source, abstract_symbol, target);
+    });
     return digraph;
 }
 
@@ -575,11 +642,14 @@ StateSet Nfa::post(const StateSet& states, const Symbol& symbol) const {
 
 void Nfa::unify_final() {
     if (final.empty() || final.size() == 1) { return; }
+    // The index is not rebuilt while adding the transitions below, it keeps the predecessors before the unification.
+    const PredecessorIndex& predecessors{ this->predecessors() };
     const State new_final_state{ add_state() };
     for (const auto& orig_final_state: final) {
-        const auto transitions_to{ delta.get_transitions_to(orig_final_state) };
-        for (const auto& transitions: transitions_to) {
-            delta.add(transitions.source, transitions.symbol, new_final_state);
+        for (const FrozenSymbolPost& symbol_post: predecessors.pre(orig_final_state)) {
+            for (const State source: symbol_post.targets) {
+                delta.add(source, symbol_post.symbol, new_final_state);
+            }
         }
         if (initial[orig_final_state]) { initial.insert(new_final_state); }
     }
@@ -594,13 +664,15 @@ Nfa& Nfa::operator=(Nfa&& other) noexcept {
         final = std::move(other.final);
         alphabet = other.alphabet;
         attributes = std::move(other.attributes);
+        predecessor_index_ = std::move(other.predecessor_index_);
+        predecessor_index_content_id_ = other.predecessor_index_content_id_;
         other.alphabet = nullptr;
     }
     return *this;
 }
 
 State Nfa::add_state() {
-    const size_t num_of_states{ this->num_of_states() };
+    const State num_of_states{ static_cast<State>(this->num_of_states()) };
     delta.allocate(num_of_states + 1);
     return num_of_states;
 }
@@ -694,7 +766,7 @@ Nfa& Nfa::unite_nondet_with(const mata::nfa::Nfa& aut) {
     this->delta.allocate(num_of_states);
 
     auto renumber_states = [&](State st) {
-        return st + num_of_states;
+        return static_cast<State>(st + num_of_states);
     };
     this->delta.append(aut.delta.renumber_targets(renumber_states));
 
@@ -820,3 +892,111 @@ Nfa Nfa::decode_utf8() const {
 
     return result;
 }
+
+namespace {
+    /**
+     * Predecessors of states in a @c FrozenDelta packed into contiguous arrays (symbols are ignored).
+     *
+     * Predecessors of state @c q are @c sources[offsets[q]], ..., @c sources[offsets[q + 1] - 1].
+     */
+    struct FrozenPredecessors {
+        std::vector<size_t> offsets;
+        std::vector<State> sources;
+
+        FrozenPredecessors(const FrozenDelta& delta, const size_t num_of_states)
+            : offsets(num_of_states + 1, 0), sources(delta.num_of_transitions()) {
+            for (State source{ 0 }; source < delta.num_of_states(); ++source) {
+                for (const FrozenSymbolPost& symbol_post: delta[source]) {
+                    for (const State target: symbol_post.targets) { ++offsets[target + 1]; }
+                }
+            }
+            for (size_t state{ 1 }; state <= num_of_states; ++state) { offsets[state] += offsets[state - 1]; }
+            std::vector<size_t> next{ offsets.begin(), offsets.end() - 1 };
+            for (State source{ 0 }; source < delta.num_of_states(); ++source) {
+                for (const FrozenSymbolPost& symbol_post: delta[source]) {
+                    for (const State target: symbol_post.targets) { sources[next[target]++] = source; }
+                }
+            }
+        }
+
+        std::span<const State> operator[](const State state) const {
+            return { sources.data() + offsets[state], sources.data() + offsets[state + 1] };
+        }
+    };
+
+}
+
+size_t FrozenNfa::num_of_states() const {
+    return std::max({
+        static_cast<size_t>(initial.domain_size()),
+        static_cast<size_t>(final.domain_size()),
+        delta.num_of_states()
+    });
+}
+
+std::vector<State> FrozenNfa::distances_from_initial() const {
+    return bfs_distances(num_of_states(), initial, [&](const State src, const auto& visit) {
+        for (const FrozenSymbolPost& symbol_post: delta[src]) {
+            for (const State target: symbol_post.targets) { visit(target); }
+        }
+    });
+}
+
+std::vector<State> FrozenNfa::distances_to_final() const {
+    const FrozenPredecessors predecessors{ delta, num_of_states() };
+    return bfs_distances(num_of_states(), final, [&](const State src, const auto& visit) {
+        for (const State source: predecessors[src]) { visit(source); }
+    });
+}
+
+BoolVector FrozenNfa::get_useful_states() const {
+    const std::vector<State> from_initial{ distances_from_initial() };
+    const std::vector<State> to_final{ distances_to_final() };
+    BoolVector useful(num_of_states(), false);
+    for (State state{ 0 }; state < useful.size(); ++state) {
+        useful[state] = from_initial[state] != Limits::max_state && to_final[state] != Limits::max_state;
+    }
+    return useful;
+}
+
+Run FrozenNfa::get_shortest_accepting_run_from_state(State q, const std::vector<State>& distances_to_final) const {
+    Run result{ {}, { q } };
+    while (!final[q]) {
+        bool moved{ false };
+        for (const FrozenSymbolPost& symbol_post: delta[q]) {
+            for (const State target: symbol_post.targets) {
+                if (distances_to_final[target] < distances_to_final[q]) {
+                    result.word.push_back(symbol_post.symbol);
+                    result.path.push_back(target);
+                    q = target;
+                    moved = true;
+                    break;
+                }
+            }
+            if (moved) { break; }
+        }
+    }
+    return result;
+}
+
+StateSet FrozenNfa::post(const StateSet& states, const Symbol symbol) const {
+    std::vector<State> targets{};
+    for (const State state: states) {
+        const FrozenStatePost state_post{ delta[state] };
+        // TODO: This does not handle epsilons.
+        const auto symbol_post_it{ state_post.find(symbol) };
+        if (symbol_post_it != state_post.end()) {
+            targets.insert(targets.end(), symbol_post_it->targets.begin(), symbol_post_it->targets.end());
+        }
+    }
+    return StateSet{ targets };
+}
+
+bool FrozenNfa::is_in_lang(const Run& run) const {
+    StateSet current_post(initial);
+    for (const Symbol symbol: run.word) {
+        current_post = post(current_post, symbol);
+        if (current_post.empty()) { return false; }
+    }
+    return final.intersects_with(current_post);
+}
@@ -2,17 +2,24 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <list>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <unordered_set>
 #include <iterator>
 
 // MATA headers
 #include "mata/nfa/delta.hh"
 #include "mata/utils/sparse-set.hh"
+#include "mata/utils/adaptive-set.hh"
+#include "mata/utils/set-arena.hh"
+#include "mata/utils/work-stealing-queues.hh"
 #include "mata/nfa/nfa.hh"
 #include "mata/nfa/algorithms.hh"
 #include "mata/nfa/builder.hh"
-#include <mata/simlib/explicit_lts.hh>
 
 using std::tie;
 
@@ -23,39 +30,6 @@ using mata::Symbol;
 using StateBoolArray = std::vector<bool>; ///< Bool array for states in the automaton.
 
 namespace {
-    Simlib::Util::BinaryRelation compute_fw_direct_simulation(const Nfa& aut) {
-        OrdVector<mata::Symbol> used_symbols = aut.delta.get_used_symbols();
-        mata::Symbol unused_symbol = 0;
-        if (!used_symbols.empty() && *used_symbols.begin() == 0) {
-            auto it = used_symbols.begin();
-            unused_symbol = *it + 1;
-            ++it;
-            const auto used_symbols_end = used_symbols.end();
-            while (it != used_symbols_end && unused_symbol == *it) {
-                unused_symbol = *it + 1;
-                ++it;
-            }
-            if (unused_symbol == 0) { // sanity check to see if we did not use the full range of mata::Symbol
-                throw std::runtime_error("all symbols are used, we cannot compute simulation reduction");
-            }
-        }
-
-        const size_t state_num{ aut.num_of_states() };
-        Simlib::ExplicitLTS lts_for_simulation(state_num);
-
-        for (const Transition& transition : aut.delta.transitions()) {
-            lts_for_simulation.add_transition(transition.source, transition.symbol, transition.target);
-        }
-
-        // final states cannot be simulated by nonfinal -> we add new selfloops over final states with new symbol in LTS
-        for (State final_state : aut.final) {
-            lts_for_simulation.add_transition(final_state, unused_symbol, final_state);
-        }
-
-        lts_for_simulation.init();
-        return lts_for_simulation.compute_simulation();
-    }
-
     Nfa reduce_size_by_simulation(const Nfa& aut, StateRenaming &state_renaming) {
         Nfa result;
         const auto sim_relation = algorithms::compute_relation(
@@ -72,7 +46,7 @@ namespace {
 
         // map each state q of aut to the state of the reduced automaton representing the simulation class of q
         for (State q = 0; q < num_of_states; ++q) {
-            const State qReprState = quot_proj[q];
+            const State qReprState = static_cast<State>(quot_proj[q]);
             if (state_renaming.count(qReprState) == 0) { // we need to map q's class to a new state in reducedAut
                 const State qClass = result.add_state();
                 state_renaming[qReprState] = qClass;
@@ -94,7 +68,7 @@ namespace {
                     const StateSet representatives_of_states_to = [&]{
                         StateSet state_set;
                         for (auto s : q_trans.targets) {
-                            state_set.insert(quot_proj[s]);
+                            state_set.insert(static_cast<State>(quot_proj[s]));
                         }
                         return state_set;
                     }();
@@ -248,7 +222,7 @@ namespace {
             return result;
         }
 
-        using Iterator = mata::utils::OrdVector<SymbolPost>::const_iterator;
+        using Iterator = StatePost::const_iterator;
         SynchronizedExistentialSymbolPostIterator synchronized_iterator;
 
         while (!worklist.empty()) {
@@ -408,7 +382,7 @@ namespace {
 
                 if (macrostate_vec[j].is_subset_of(macrostate_vec[i])) {           // found covering state
                     covering_set.insert(macrostate_vec[j]);               // is not covered
-                    covering_indexes.push_back(j);
+                    covering_indexes.push_back(static_cast<State>(j));
                 }
             }
 
@@ -525,68 +499,149 @@ bool mata::nfa::Nfa::make_complete(const OrdVector<Symbol>& symbols, const std::
     return transition_added;
 }
 
-//TODO: based on the comments inside, this function needs to be rewritten in a more optimal way.
-Nfa mata::nfa::remove_epsilon(const Nfa& aut, Symbol epsilon) {
-    // cannot use multimap, because it can contain multiple occurrences of (a -> a), (a -> a)
-    std::unordered_map<State, StateSet> eps_closure;
+Delta mata::nfa::algorithms::remove_epsilon_transitions(
+    const Delta& delta, const Symbol epsilon, SparseSet<State>& final) {
+    const size_t num_of_states{ delta.num_of_states() };
+    constexpr size_t NOT_VISITED{ std::numeric_limits<size_t>::max() };
+    static const TargetSet no_targets{};
+    const auto epsilon_targets = [&](const State state) -> const TargetSet& {
+        const StatePost& state_post{ delta[state] };
+        const auto epsilon_symbol_post{ Delta::epsilon_symbol_posts(state_post, epsilon) };
+        return epsilon_symbol_post == state_post.end() ? no_targets : epsilon_symbol_post->targets;
+    };
 
-    // TODO: grossly inefficient
-    // first we compute the epsilon closure
-    const size_t num_of_states{aut.num_of_states() };
-    for (size_t i{ 0 }; i < num_of_states; ++i)
-    {
-        for (const auto& trans: aut.delta[i])
-        { // initialize
-            const auto it_ins_pair = eps_closure.insert({i, {i}});
-            if (trans.symbol == epsilon)
-            {
-                StateSet& closure = it_ins_pair.first->second;
-                // TODO: Fix possibly insert to OrdVector. Create list already ordered, then merge (do not need to resize each time);
-                closure.insert(trans.targets);
+    Delta result(num_of_states);
+    // Tarjan's algorithm on the epsilon transitions. An SCC is finished only after all SCCs reachable from it, so the
+    //  closure of the SCC is computed right away from the closures of its successor SCCs, and shared by all its states.
+    std::vector<size_t> index(num_of_states, NOT_VISITED);
+    std::vector<size_t> lowlink(num_of_states);
+    std::vector<size_t> scc_of(num_of_states, NOT_VISITED);
+    std::vector<State> tarjan_stack{};
+    struct Frame {
+        State state;
+        TargetSet::const_iterator next_target;
+        TargetSet::const_iterator targets_end;
+    };
+    std::vector<Frame> call_stack{};
+    size_t next_index{ 0 };
+
+    // Closures of finished SCCs, as sorted sets stored back to back.
+    std::vector<State> closure_elements{};
+    std::vector<size_t> closure_offsets{ 0 };
+    // Generation marks of states already in the closure being computed (the number of the SCC).
+    std::vector<size_t> closure_mark(num_of_states, NOT_VISITED);
+    std::vector<State> scc_states{};
+    std::vector<Move> moves{};
+
+    const auto finish_scc = [&](const State root) {
+        const size_t scc{ closure_offsets.size() - 1 };
+        scc_states.clear();
+        State state;
+        do {
+            state = tarjan_stack.back();
+            tarjan_stack.pop_back();
+            scc_of[state] = scc;
+            scc_states.push_back(state);
+        } while (state != root);
+
+        const size_t closure_begin{ closure_elements.size() };
+        for (const State scc_state: scc_states) {
+            closure_mark[scc_state] = scc;
+            closure_elements.push_back(scc_state);
+        }
+        for (const State scc_state: scc_states) {
+            for (const State target: epsilon_targets(scc_state)) {
+                const size_t target_scc{ scc_of[target] };
+                if (target_scc == scc || closure_mark[target] == scc) { continue; }
+                for (size_t position{ closure_offsets[target_scc] }; position < closure_offsets[target_scc + 1];
+                     ++position) {
+                    const State closure_state{ closure_elements[position] };
+                    if (closure_mark[closure_state] != scc) {
+                        closure_mark[closure_state] = scc;
+                        closure_elements.push_back(closure_state);
+                    }
+                }
             }
         }
-    }
+        const auto closure_first{ closure_elements.begin() + static_cast<long>(closure_begin) };
+        std::sort(closure_first, closure_elements.end());
+        closure_offsets.push_back(closure_elements.size());
 
-    bool changed = true;
-    while (changed) { // Compute the fixpoint.
-        changed = false;
-        for (size_t i = 0; i < num_of_states; ++i) {
-            const StatePost& post{ aut.delta[i] };
-            const auto eps_move_it { post.find(epsilon) };//TODO: make faster if default epsilon
-            if (eps_move_it != post.end()) {
-                StateSet& src_eps_cl = eps_closure[i];
-                for (const State tgt: eps_move_it->targets) {
-                    const StateSet& tgt_eps_cl = eps_closure[tgt];
-                    for (const State st: tgt_eps_cl) {
-                        if (src_eps_cl.count(st) == 0) {
-                            changed = true;
-                            break;
-                        }
-                    }
-                    src_eps_cl.insert(tgt_eps_cl);
-                }
+        // States without epsilon transitions keep their state posts.
+        if (scc_states.size() == 1 && epsilon_targets(root).empty()) {
+            result.mutable_state_post(root) = delta[root];
+            return;
+        }
+
+        bool is_final{ false };
+        moves.clear();
+        for (auto closure_it{ closure_first }; closure_it != closure_elements.end(); ++closure_it) {
+            is_final = is_final || final.contains(*closure_it);
+            for (const SymbolPost& symbol_post: delta[*closure_it]) {
+                if (symbol_post.symbol == epsilon) { continue; }
+                for (const State target: symbol_post.targets) { moves.push_back(Move{ symbol_post.symbol, target }); }
             }
         }
-    }
+        std::sort(moves.begin(), moves.end(), [](const Move& lhs, const Move& rhs) {
+            return lhs.symbol < rhs.symbol || (lhs.symbol == rhs.symbol && lhs.target < rhs.target);
+        });
+        const auto moves_end{ std::unique(moves.begin(), moves.end()) };
+        StatePost state_post{};
+        for (auto symbol_begin{ moves.begin() }; symbol_begin != moves_end;) {
+            const Symbol symbol{ symbol_begin->symbol };
+            const auto symbol_end{ std::find_if(symbol_begin, moves_end,
+                                                [symbol](const Move& move) { return move.symbol != symbol; }) };
+            TargetSet targets{};
+            targets.reserve(static_cast<size_t>(symbol_end - symbol_begin));
+            for (; symbol_begin != symbol_end; ++symbol_begin) { targets.push_back(symbol_begin->target); }
+            state_post.emplace_back(symbol, std::move(targets));
+        }
+
+        std::sort(scc_states.begin(), scc_states.end());
+        for (const State scc_state: scc_states) {
+            if (is_final) { final.insert(scc_state); }
+            result.mutable_state_post(scc_state) = state_post;
+        }
+    };
 
-    // Construct the automaton without epsilon transitions.
-    Nfa result{ Delta{}, aut.initial, aut.final, aut.alphabet };
-    for (const auto& state_closure_pair : eps_closure) { // For every state.
-        State src_state = state_closure_pair.first;
-        for (State eps_cl_state : state_closure_pair.second) { // For every state in its epsilon closure.
-            if (aut.final[eps_cl_state]) result.final.insert(src_state);
-            for (const SymbolPost& move : aut.delta[eps_cl_state]) {
-                if (move.symbol == epsilon) continue;
-                // TODO: this could be done more efficiently if we had a better add method
-                for (State tgt_state : move.targets) {
-                    result.delta.add(src_state, move.symbol, tgt_state);
+    for (State root{ 0 }; root < num_of_states; ++root) {
+        if (index[root] != NOT_VISITED) { continue; }
+        index[root] = lowlink[root] = next_index++;
+        tarjan_stack.push_back(root);
+        const TargetSet& root_targets{ epsilon_targets(root) };
+        call_stack.push_back(Frame{ root, root_targets.begin(), root_targets.end() });
+        while (!call_stack.empty()) {
+            Frame& frame{ call_stack.back() };
+            const State state{ frame.state };
+            if (frame.next_target != frame.targets_end) {
+                const State target{ *frame.next_target++ };
+                if (index[target] == NOT_VISITED) {
+                    index[target] = lowlink[target] = next_index++;
+                    tarjan_stack.push_back(target);
+                    const TargetSet& targets{ epsilon_targets(target) };
+                    call_stack.push_back(Frame{ target, targets.begin(), targets.end() });
+                } else if (scc_of[target] == NOT_VISITED) { // The target is on the Tarjan's stack.
+                    lowlink[state] = std::min(lowlink[state], index[target]);
                 }
+                continue;
             }
+            call_stack.pop_back();
+            if (!call_stack.empty()) {
+                const State parent{ call_stack.back().state };
+                lowlink[parent] = std::min(lowlink[parent], lowlink[state]);
+            }
+            if (lowlink[state] == index[state]) { finish_scc(state); }
         }
     }
     return result;
 }
 
+Nfa mata::nfa::remove_epsilon(const Nfa& aut, Symbol epsilon) {
+    Nfa result{ Delta{}, aut.initial, aut.final, aut.alphabet };
+    result.delta = algorithms::remove_epsilon_transitions(aut.delta, epsilon, result.final);
+    return result;
+}
+
 Nfa mata::nfa::fragile_revert(const Nfa& aut) {
     const size_t num_of_states{ aut.num_of_states() };
 
@@ -757,7 +812,7 @@ Nfa mata::nfa::somewhat_simple_revert(const Nfa& aut) {
     }
 
     //sorting the targets
-    for (State q = 0, states_num = result.delta.num_of_states(); q < states_num; ++q) {
+    for (State q = 0, states_num = static_cast<State>(result.delta.num_of_states()); q < states_num; ++q) {
         //Post & post = result.delta.get_mutable_post(q);
         //utils::sort_and_rmdupl(post);
         for (SymbolPost& m: result.delta.mutable_state_post(q)) { sort_and_rmdupl(m.targets); }
@@ -767,7 +822,27 @@ Nfa mata::nfa::somewhat_simple_revert(const Nfa& aut) {
 }
 
 Nfa mata::nfa::revert(const Nfa& aut) {
-    return simple_revert(aut);
+    const PredecessorIndex& predecessors{ aut.predecessors() };
+    Nfa result{ aut.num_of_states() };
+    // Predecessors are grouped by symbols and ordered, they are copied to the reverted state posts as they are.
+    for (State state{ 0 }; state < predecessors.num_of_states(); ++state) {
+        const FrozenStatePost symbol_posts{ predecessors.pre(state) };
+        if (symbol_posts.empty()) { continue; }
+        StatePost& state_post{ result.delta.mutable_state_post(state) };
+        state_post.reserve(symbol_posts.size());
+        for (const FrozenSymbolPost& symbol_post: symbol_posts) {
+            TargetSet sources{};
+            sources.reserve(symbol_post.targets.size());
+            for (const State source: symbol_post.targets) { sources.push_back(source); }
+            state_post.push_back({ symbol_post.symbol, std::move(sources) });
+        }
+    }
+
+    result.initial = aut.final;
+    result.final = aut.initial;
+
+    return result;
+    //return simple_revert(aut);
     //return fragile_revert(aut);
     //return somewhat_simple_revert(aut);
 }
@@ -777,8 +852,8 @@ bool mata::nfa::Nfa::is_deterministic() const {
 
     if (delta.empty()) { return true; }
 
-    const size_t aut_size = num_of_states();
-    for (size_t i = 0; i < aut_size; ++i) {
+    const State aut_size = static_cast<State>(num_of_states());
+    for (State i = 0; i < aut_size; ++i) {
         for (const auto& symStates : delta[i]) {
             if (symStates.num_of_targets() != 1) { return false; }
         }
@@ -931,9 +1006,6 @@ Nfa mata::nfa::minimize(
                 const Nfa& aut,
                 const ParameterMap& params)
 {
-    Nfa result;
-    // setting the default algorithm
-    decltype(algorithms::minimize_brzozowski)* algo = algorithms::minimize_brzozowski;
     if (!haskey(params, "algorithm")) {
         throw std::runtime_error(std::to_string(__func__) +
             " requires setting the \"algorithm\" key in the \"params\" argument; "
@@ -941,13 +1013,28 @@ Nfa mata::nfa::minimize(
     }
 
     const std::string& str_algo = params.at("algorithm");
-    if ("brzozowski" == str_algo) {  /* default */ }
-    else {
-        throw std::runtime_error(std::to_string(__func__) +
-            " received an unknown value of the \"algorithm\" key: " + str_algo);
-    }
-
-    return algo(aut);
+    if ("brzozowski" == str_algo) { return algorithms::minimize_brzozowski(aut); }
+    if ("hopcroft" == str_algo) {
+        Nfa dfa{ aut.is_deterministic() ? aut : determinize(aut) };
+        dfa.trim();
+        // The minimal automaton for the empty language is a single initial state.
+        if (dfa.initial.empty()) { return Nfa{ 1, { 0 }, {} }; }
+        return algorithms::minimize_hopcroft(dfa);
+    }
+    if ("valmari" == str_algo) {
+        return algorithms::minimize_valmari(aut.is_deterministic() ? aut : determinize(aut));
+    }
+    if ("auto" == str_algo) {
+        if (aut.is_deterministic()) { return algorithms::minimize_valmari(aut); }
+        // By Brzozowski's theorem, determinizing a co-deterministic automaton whose states all reach a final state
+        //  gives the minimal automaton directly.
+        Nfa trimmed{ aut };
+        trimmed.trim();
+        if (revert(trimmed).is_deterministic()) { return determinize(trimmed); }
+        return algorithms::minimize_valmari(determinize(trimmed));
+    }
+    throw std::runtime_error(std::to_string(__func__) +
+        " received an unknown value of the \"algorithm\" key: " + str_algo);
 }
 
 // Anonymous namespace for the Hopcroft minimization algorithm.
@@ -1005,8 +1092,7 @@ public:
 
         // Transitions are grouped by symbols using counting sort in time O(m).
         // Count the number of elements and the number of sets.
-        for (const auto &trans : delta.transitions()) {
-            const Symbol a = trans.symbol;
+        delta.for_each_transition([&](State, const Symbol a, State) {
             if (symbol_map.find(a) == symbol_map.end()) {
                 symbol_map[a] = num_of_sets++;
                 counts.push_back(1);
@@ -1014,7 +1100,7 @@ public:
                 ++counts[symbol_map[a]];
             }
             ++num_of_transitions;
-        }
+        });
 
         // Initialize data structures.
         elems.resize(num_of_transitions);
@@ -1038,8 +1124,7 @@ public:
         // Fill the sets from the back.
         // Mid, decremented before use, is used as an index for the next element.
         size_t trans_idx = 0;   // Index of the transition in the (flattened) delta.
-        for (const auto &trans : delta.transitions()) {
-            const Symbol a = trans.symbol;
+        delta.for_each_transition([&](State, const Symbol a, State) {
             const size_t a_idx = symbol_map[a];
             const size_t trans_loc = mid[a_idx] - 1;
             mid[a_idx] = trans_loc;
@@ -1047,7 +1132,7 @@ public:
             location[trans_idx] = trans_loc;
             set_idx[trans_idx] = a_idx;
             ++trans_idx;
-        }
+        });
     }
 
     RefinablePartition(const RefinablePartition &other)
@@ -1129,9 +1214,9 @@ public:
         const size_t e_set_mid = mid[e_set];
         if (e_loc >= e_set_mid) {
             elems[e_loc] = elems[e_set_mid];
-            location[elems[e_loc]] = e_loc;
+            location[elems[e_loc]] = static_cast<T>(e_loc);
             elems[e_set_mid] = e;
-            location[e] = e_set_mid;
+            location[e] = static_cast<T>(e_set_mid);
             mid[e_set] = e_set_mid + 1;
         }
     }
@@ -1196,11 +1281,11 @@ Nfa mata::nfa::algorithms::minimize_hopcroft(const Nfa& dfa_trimmed) {
     std::vector<State> trans_source_map(trp.size());
     std::vector<std::vector<size_t>> incomming_trans_idxs(brp.size(), std::vector<size_t>());
     size_t trans_idx = 0;
-    for (const auto &trans : dfa_trimmed.delta.transitions()) {
-        trans_source_map[trans_idx] = trans.source;
-        incomming_trans_idxs[trans.target].push_back(trans_idx);
+    dfa_trimmed.delta.for_each_transition([&](const State source, Symbol, const State target) {
+        trans_source_map[trans_idx] = source;
+        incomming_trans_idxs[target].push_back(trans_idx);
         ++trans_idx;
-    }
+    });
 
     // Worklists for the Hopcroft algorithm.
     std::stack<size_t> unready_spls;    // Splitters that will be used in the backpropagation.
@@ -1285,8 +1370,8 @@ Nfa mata::nfa::algorithms::minimize_hopcroft(const Nfa& dfa_trimmed) {
 
     // Construct the minimized automaton using equivalence classes (BRP).
     assert(dfa_trimmed.initial.size() == 1);
-    Nfa result(brp.num_of_sets, { brp.set_idx[*dfa_trimmed.initial.begin()] }, {});
-    for (size_t block_idx = 0; block_idx < brp.num_of_sets; ++block_idx) {
+    Nfa result(brp.num_of_sets, { static_cast<State>(brp.set_idx[*dfa_trimmed.initial.begin()]) }, {});
+    for (State block_idx = 0; block_idx < brp.num_of_sets; ++block_idx) {
         const State q = brp.get_first(block_idx);
         if (dfa_trimmed.final.contains(q)) {
             result.final.insert(block_idx);
@@ -1294,7 +1379,7 @@ Nfa mata::nfa::algorithms::minimize_hopcroft(const Nfa& dfa_trimmed) {
         StatePost &mut_state_post = result.delta.mutable_state_post(block_idx);
         for (const SymbolPost &symbol_post : dfa_trimmed.delta[q]) {
             assert(symbol_post.targets.size() == 1);
-            const State target = brp.set_idx[*symbol_post.targets.begin()];
+            const State target = static_cast<State>(brp.set_idx[*symbol_post.targets.begin()]);
             mut_state_post.push_back(SymbolPost{ symbol_post.symbol, StateSet{ target } });
         }
     }
@@ -1303,6 +1388,215 @@ Nfa mata::nfa::algorithms::minimize_hopcroft(const Nfa& dfa_trimmed) {
 }
 
 
+// Anonymous namespace for the Valmari-Lehtinen minimization algorithm.
+namespace {
+/**
+ * Partition of numbers 0, ..., n-1 into sets, refined by marking elements and splitting the sets with marked elements.
+ *
+ * Unlike @c RefinablePartition, @c split() gives the new set index to the smaller of the marked and the unmarked part,
+ *  so each element is moved to a new set at most log(n) times.
+ */
+class SmallerHalfPartition {
+public:
+    size_t num_of_sets{ 0 };
+    std::vector<size_t> elems;     ///< Elements ordered so that the elements of the same set are contiguous.
+    std::vector<size_t> location;  ///< Location of each element in @c elems.
+    std::vector<size_t> set_idx;   ///< Set of each element.
+    std::vector<size_t> first;     ///< Index of the first element of each set in @c elems.
+    std::vector<size_t> end;       ///< Index after the last element of each set in @c elems.
+
+    explicit SmallerHalfPartition(const size_t num_of_elements)
+        : num_of_sets{ num_of_elements == 0 ? 0ul : 1ul }, elems(num_of_elements), location(num_of_elements),
+          set_idx(num_of_elements, 0), first(num_of_elements + 1), end(num_of_elements + 1),
+          num_of_marked(num_of_elements + 1, 0) {
+        std::iota(elems.begin(), elems.end(), 0);
+        std::iota(location.begin(), location.end(), 0);
+        end[0] = num_of_elements;
+    }
+
+    /// Mark @p elem: move it to the marked prefix of its set.
+    void mark(const size_t elem) {
+        const size_t set{ set_idx[elem] };
+        const size_t elem_location{ location[elem] };
+        const size_t marked_end{ first[set] + num_of_marked[set] };
+        elems[elem_location] = elems[marked_end];
+        location[elems[elem_location]] = elem_location;
+        elems[marked_end] = elem;
+        location[elem] = marked_end;
+        if (num_of_marked[set]++ == 0) { touched_sets.push_back(set); }
+    }
+
+    /// Split all sets with marked elements into the marked and the unmarked part, and unmark all elements.
+    void split() {
+        while (!touched_sets.empty()) {
+            const size_t set{ touched_sets.back() };
+            touched_sets.pop_back();
+            const size_t marked_end{ first[set] + num_of_marked[set] };
+            if (marked_end == end[set]) { // All elements are marked.
+                num_of_marked[set] = 0;
+                continue;
+            }
+            if (num_of_marked[set] <= end[set] - marked_end) {
+                first[num_of_sets] = first[set];
+                end[num_of_sets] = first[set] = marked_end;
+            } else {
+                end[num_of_sets] = end[set];
+                first[num_of_sets] = end[set] = marked_end;
+            }
+            for (size_t l{ first[num_of_sets] }; l < end[num_of_sets]; ++l) { set_idx[elems[l]] = num_of_sets; }
+            num_of_marked[set] = num_of_marked[num_of_sets] = 0;
+            ++num_of_sets;
+        }
+    }
+
+private:
+    std::vector<size_t> num_of_marked; ///< Number of marked elements of each set.
+    std::vector<size_t> touched_sets{}; ///< Sets with marked elements.
+};
+} // namespace
+
+Nfa mata::nfa::algorithms::minimize_valmari(const Nfa& dfa) {
+    assert(dfa.is_deterministic() || dfa.initial.empty());
+    if (dfa.initial.empty()) { return Nfa{ 1, { 0 }, {} }; }
+    const size_t num_of_states{ dfa.num_of_states() };
+    const State initial_state{ *dfa.initial.begin() };
+
+    // Transitions of the DFA, and the incoming transitions of each state (ordered by targets).
+    std::vector<State> trans_source{};
+    std::vector<Symbol> trans_symbol{};
+    std::vector<State> trans_target{};
+    dfa.delta.for_each_transition([&](const State source, const Symbol symbol, const State target) {
+        trans_source.push_back(source);
+        trans_symbol.push_back(symbol);
+        trans_target.push_back(target);
+    });
+    const auto group_by = [&](const std::vector<State>& key, std::vector<size_t>& offsets, std::vector<size_t>& trans) {
+        offsets.assign(num_of_states + 1, 0);
+        for (const State state: key) { ++offsets[state + 1]; }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        trans.resize(key.size());
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (size_t trans_idx{ 0 }; trans_idx < key.size(); ++trans_idx) { trans[next[key[trans_idx]]++] = trans_idx; }
+    };
+    std::vector<size_t> outgoing_offsets, outgoing, incoming_offsets, incoming;
+    group_by(trans_source, outgoing_offsets, outgoing);
+    group_by(trans_target, incoming_offsets, incoming);
+
+    // Remove irrelevant states: states not reachable from the initial state and states not reaching a final state.
+    const auto search = [](std::vector<State> worklist, std::vector<bool>& visited, const std::vector<size_t>& offsets,
+                           const std::vector<size_t>& trans, const std::vector<State>& trans_next,
+                           const std::vector<bool>* allowed) {
+        for (const State state: worklist) { visited[state] = true; }
+        while (!worklist.empty()) {
+            const State state{ worklist.back() };
+            worklist.pop_back();
+            for (size_t position{ offsets[state] }; position < offsets[state + 1]; ++position) {
+                const State next{ trans_next[trans[position]] };
+                if (!visited[next] && (allowed == nullptr || (*allowed)[next])) {
+                    visited[next] = true;
+                    worklist.push_back(next);
+                }
+            }
+        }
+    };
+    std::vector<bool> reachable(num_of_states, false);
+    search({ initial_state }, reachable, outgoing_offsets, outgoing, trans_target, nullptr);
+    std::vector<State> reachable_final_states{};
+    for (const State state: dfa.final) {
+        if (reachable[state]) { reachable_final_states.push_back(state); }
+    }
+    if (reachable_final_states.empty()) { return Nfa{ 1, { 0 }, {} }; }
+    std::vector<bool> relevant(num_of_states, false);
+    search(reachable_final_states, relevant, incoming_offsets, incoming, trans_source, &reachable);
+
+    // Renumber the relevant states and transitions between them.
+    std::vector<size_t> renaming(num_of_states);
+    size_t num_of_relevant_states{ 0 };
+    for (State state{ 0 }; state < num_of_states; ++state) {
+        if (relevant[state]) { renaming[state] = num_of_relevant_states++; }
+    }
+    std::vector<size_t> relevant_trans{};
+    for (size_t trans_idx{ 0 }; trans_idx < trans_source.size(); ++trans_idx) {
+        if (relevant[trans_source[trans_idx]] && relevant[trans_target[trans_idx]]) {
+            relevant_trans.push_back(trans_idx);
+        }
+    }
+    const size_t num_of_relevant_trans{ relevant_trans.size() };
+    // Incoming relevant transitions of relevant states, in the numbering of relevant transitions.
+    std::vector<size_t> relevant_incoming_offsets(num_of_relevant_states + 1, 0);
+    for (const size_t trans_idx: relevant_trans) { ++relevant_incoming_offsets[renaming[trans_target[trans_idx]] + 1]; }
+    std::partial_sum(relevant_incoming_offsets.begin(), relevant_incoming_offsets.end(),
+                     relevant_incoming_offsets.begin());
+    std::vector<size_t> relevant_incoming(num_of_relevant_trans);
+    {
+        std::vector<size_t> next(relevant_incoming_offsets.begin(), relevant_incoming_offsets.end() - 1);
+        for (size_t relevant_idx{ 0 }; relevant_idx < num_of_relevant_trans; ++relevant_idx) {
+            relevant_incoming[next[renaming[trans_target[relevant_trans[relevant_idx]]]]++] = relevant_idx;
+        }
+    }
+
+    // Blocks of states, initially split into final and non-final states.
+    SmallerHalfPartition blocks(num_of_relevant_states);
+    for (const State state: reachable_final_states) { blocks.mark(renaming[state]); }
+    blocks.split();
+
+    // Cords of transitions (transitions over a common symbol to a common block), initially split by symbols.
+    SmallerHalfPartition cords(num_of_relevant_trans);
+    if (num_of_relevant_trans > 0) {
+        std::stable_sort(cords.elems.begin(), cords.elems.end(), [&](const size_t lhs, const size_t rhs) {
+            return trans_symbol[relevant_trans[lhs]] < trans_symbol[relevant_trans[rhs]];
+        });
+        cords.num_of_sets = 0;
+        Symbol cord_symbol{ trans_symbol[relevant_trans[cords.elems[0]]] };
+        for (size_t l{ 0 }; l < num_of_relevant_trans; ++l) {
+            const size_t relevant_idx{ cords.elems[l] };
+            const Symbol symbol{ trans_symbol[relevant_trans[relevant_idx]] };
+            if (symbol != cord_symbol) {
+                cord_symbol = symbol;
+                cords.end[cords.num_of_sets++] = l;
+                cords.first[cords.num_of_sets] = l;
+            }
+            cords.set_idx[relevant_idx] = cords.num_of_sets;
+            cords.location[relevant_idx] = l;
+        }
+        cords.end[cords.num_of_sets++] = num_of_relevant_trans;
+    }
+
+    // Split blocks by cords and cords by blocks. Each block except the first one is used to split cords only once,
+    //  when it is created as the smaller half of a split block.
+    size_t block{ 1 };
+    for (size_t cord{ 0 }; cord < cords.num_of_sets; ++cord) {
+        for (size_t l{ cords.first[cord] }; l < cords.end[cord]; ++l) {
+            blocks.mark(renaming[trans_source[relevant_trans[cords.elems[l]]]]);
+        }
+        blocks.split();
+        for (; block < blocks.num_of_sets; ++block) {
+            for (size_t l{ blocks.first[block] }; l < blocks.end[block]; ++l) {
+                const size_t state{ blocks.elems[l] };
+                for (size_t position{ relevant_incoming_offsets[state] };
+                     position < relevant_incoming_offsets[state + 1]; ++position) {
+                    cords.mark(relevant_incoming[position]);
+                }
+            }
+            cords.split();
+        }
+    }
+
+    // Construct the minimized automaton with blocks as states: transitions are taken from the first state of each block.
+    Nfa result(blocks.num_of_sets, { static_cast<State>(blocks.set_idx[renaming[initial_state]]) }, {});
+    for (const State state: reachable_final_states) {
+        result.final.insert(static_cast<State>(blocks.set_idx[renaming[state]]));
+    }
+    for (const size_t trans_idx: relevant_trans) {
+        const size_t source{ renaming[trans_source[trans_idx]] };
+        if (blocks.location[source] != blocks.first[blocks.set_idx[source]]) { continue; }
+        result.delta.mutable_state_post(static_cast<State>(blocks.set_idx[source])).push_back(
+            SymbolPost{ trans_symbol[trans_idx],
+                        StateSet{ static_cast<State>(blocks.set_idx[renaming[trans_target[trans_idx]]]) } });
+    }
+    return result;
+}
+
 Nfa mata::nfa::intersection(const Nfa& lhs, const Nfa& rhs, const Symbol first_epsilon, std::unordered_map<std::pair<State, State>, State>  *prod_map) {
 
     auto both_final = [&](const State lhs_state,const State rhs_state) {
@@ -1325,6 +1619,48 @@ Nfa mata::nfa::union_product(const Nfa &lhs, const Nfa &rhs, const Symbol first_
     return algorithms::product(lhs, rhs, one_final, first_epsilon, prod_map);
 }
 
+Nfa mata::nfa::intersection(const std::vector<const Nfa*>& nfas, const Symbol first_epsilon, const bool trim) {
+    if (nfas.empty()) {
+        throw std::runtime_error(std::to_string(__func__) + " requires at least one NFA");
+    }
+    if (std::any_of(nfas.begin(), nfas.end(), [](const Nfa* nfa) {
+        return nfa->initial.empty() || nfa->final.empty();
+    })) { return Nfa{}; }
+
+    auto all_final = [&](const std::span<const State> tuple) {
+        for (size_t i{ 0 }; i < nfas.size(); ++i) {
+            if (!nfas[i]->final.contains(tuple[i])) { return false; }
+        }
+        return true;
+    };
+    if (!trim) { return algorithms::product(nfas, all_final, first_epsilon); }
+
+    std::vector<BoolVector> useful_states{};
+    useful_states.reserve(nfas.size());
+    for (const Nfa* nfa: nfas) { useful_states.push_back(nfa->get_useful_states()); }
+    Nfa result{ algorithms::product(nfas, all_final, first_epsilon, &useful_states) };
+    // Tuples of useful states need not be useful in the product.
+    result.trim();
+    return result;
+}
+
+Nfa mata::nfa::union_product(const std::vector<const Nfa*>& nfas, const Symbol first_epsilon) {
+    std::vector<const Nfa*> non_empty{};
+    std::copy_if(nfas.begin(), nfas.end(), std::back_inserter(non_empty), [](const Nfa* nfa) {
+        return !nfa->initial.empty() && !nfa->final.empty();
+    });
+    if (non_empty.empty()) { return Nfa{}; }
+    if (non_empty.size() == 1) { return *non_empty.front(); }
+
+    auto one_final = [&](const std::span<const State> tuple) {
+        for (size_t i{ 0 }; i < non_empty.size(); ++i) {
+            if (non_empty[i]->final.contains(tuple[i])) { return true; }
+        }
+        return false;
+    };
+    return algorithms::product(non_empty, one_final, first_epsilon);
+}
+
 Nfa mata::nfa::union_nondet(const Nfa &lhs, const Nfa &rhs) { return Nfa{ lhs }.unite_nondet_with(rhs); }
 
 Simlib::Util::BinaryRelation mata::nfa::algorithms::compute_relation(const Nfa& aut, const ParameterMap& params) {
@@ -1341,13 +1677,16 @@ Simlib::Util::BinaryRelation mata::nfa::algorithms::compute_relation(const Nfa&
 
     const std::string& relation = params.at("relation");
     const std::string& direction = params.at("direction");
-    if ("simulation" == relation && direction == "forward") {
-        return compute_fw_direct_simulation(aut);
-    }
-    else {
+    if ("simulation" != relation) {
         throw std::runtime_error(std::to_string(__func__) +
                                  " received an unknown value of the \"relation\" key: " + relation);
     }
+    if ("forward" == direction) { return compute_direct_simulation(aut.delta, aut.num_of_states(), aut.final); }
+    if ("backward" == direction) {
+        return compute_direct_simulation(aut.delta, aut.num_of_states(), aut.initial, true);
+    }
+    throw std::runtime_error(std::to_string(__func__) +
+                             " received an unknown value of the \"direction\" key: " + direction);
 }
 
 Nfa mata::nfa::reduce(const Nfa &aut, StateRenaming *state_renaming, const ParameterMap& params) {
@@ -1393,36 +1732,210 @@ Nfa mata::nfa::reduce(const Nfa &aut, StateRenaming *state_renaming, const Param
     return result;
 }
 
-Nfa mata::nfa::determinize(
-    const Nfa&  aut, std::unordered_map<StateSet, State>* subset_map,
-    std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>> macrostate_discover
+namespace {
+/**
+ * Unite the targets of @p symbol_post_its into @p targets.
+ *
+ * The targets are merged by a priority queue (as in @c SynchronizedExistentialSymbolPostIterator::unify_targets()) into
+ *  a reused buffer and the hash of the united set (see @c SetArena::hash()) is computed during the merge.
+ * @return The hash of the united targets.
+ */
+template<class SymbolPostIterator>
+size_t unify_targets_into(const std::vector<SymbolPostIterator>& symbol_post_its, std::vector<State>& targets) {
+    using MacrostateArena = SetArena<State>;
+    targets.clear();
+    size_t hash{ 0 };
+    if (symbol_post_its.size() == 1) {
+        for (const State target: symbol_post_its.front()->targets) {
+            targets.push_back(target);
+            hash ^= MacrostateArena::element_hash(target);
+        }
+        return hash;
+    }
+
+    using TargetIterator = decltype(symbol_post_its.front()->cbegin());
+    using TargetSetBeginEndPair = std::pair<TargetIterator, TargetIterator>;
+    auto compare = [](const auto& a, const auto& b) { return *(a.first) > *(b.first); };
+    std::priority_queue<TargetSetBeginEndPair, std::vector<TargetSetBeginEndPair>, decltype(compare)> queue(compare);
+    for (const SymbolPostIterator& symbol_post_it: symbol_post_its) {
+        queue.emplace(symbol_post_it->cbegin(), symbol_post_it->cend());
+    }
+    while (!queue.empty()) {
+        auto item = queue.top();
+        queue.pop();
+        if (targets.empty() || targets.back() != *(item.first)) {
+            targets.push_back(*(item.first));
+            hash ^= MacrostateArena::element_hash(*(item.first));
+        }
+        if (++item.first != item.second) { queue.emplace(item); }
+    }
+    return hash;
+}
+
+/**
+ * @brief Epsilon closures of states, computed on demand and memoized.
+ *
+ * Symbols greater or equal to the first epsilon are epsilons. The closure of a state is computed by a depth-first
+ *  search over epsilon transitions, which does not continue from states whose closures are already known.
+ * @tparam DeltaType @c Delta or @c FrozenDelta.
+ */
+template<class DeltaType>
+class EpsilonClosures {
+public:
+    EpsilonClosures(const DeltaType& delta, const Symbol first_epsilon)
+        : delta_{ delta }, first_epsilon_{ first_epsilon } {}
+
+    Symbol first_epsilon() const { return first_epsilon_; }
+
+    /**
+     * Get the sorted epsilon closure of @p state.
+     *
+     * The returned view is invalidated by computing a closure of another state.
+     */
+    std::span<const State> of(const State state) {
+        if (state >= closures_.size()) { closures_.resize(state + 1); computed_.resize(state + 1, false); }
+        if (!computed_[state]) { compute(state); }
+        return closures_[state];
+    }
+
+    /**
+     * Replace sorted @p states by the union of their epsilon closures.
+     * @return Hash of the closed set (see @c SetArena::hash()).
+     */
+    size_t close(std::vector<State>& states) {
+        if (states.size() == 1) {
+            const std::span<const State> closure{ of(states.front()) };
+            states.assign(closure.begin(), closure.end());
+            return SetArena<State>::hash(states);
+        }
+        // Computing a closure uses the marks, hence all closures are computed before marking the united states.
+        for (const State state: states) { of(state); }
+        closed_.clear();
+        ++generation_;
+        for (const State state: states) {
+            for (const State reached: closures_[state]) {
+                if (mark(reached)) { closed_.push_back(reached); }
+            }
+        }
+        std::sort(closed_.begin(), closed_.end());
+        std::swap(states, closed_);
+        return SetArena<State>::hash(states);
+    }
+
+    /// Get the union of epsilon closures of @p states.
+    StateSet close(const StateSet& states) {
+        std::vector<State> closed(states.begin(), states.end());
+        close(closed);
+        return StateSet(closed);
+    }
+
+private:
+    const DeltaType& delta_;
+    const Symbol first_epsilon_;
+    std::vector<std::vector<State>> closures_{};
+    std::vector<bool> computed_{};
+    /// Generation of the last visit of each state, used to mark visited states without clearing.
+    std::vector<size_t> visited_{};
+    size_t generation_{ 0 };
+    std::vector<State> closed_{};
+    std::vector<State> stack_{};
+
+    /// Mark @p state as visited in the current generation. @return True if it has not been visited yet.
+    bool mark(const State state) {
+        if (state >= visited_.size()) { visited_.resize(state + 1, 0); }
+        if (visited_[state] == generation_) { return false; }
+        visited_[state] = generation_;
+        return true;
+    }
+
+    void compute(const State state) {
+        ++generation_;
+        std::vector<State> closure{};
+        mark(state);
+        stack_.assign(1, state);
+        while (!stack_.empty()) {
+            const State current{ stack_.back() };
+            stack_.pop_back();
+            if (current != state && current < closures_.size() && computed_[current]) {
+                for (const State reached: closures_[current]) {
+                    if (reached == current || mark(reached)) { closure.push_back(reached); }
+                }
+                continue;
+            }
+            closure.push_back(current);
+            const auto& state_post{ delta_[current] };
+            for (auto symbol_post_it{ state_post.first_epsilon_it(first_epsilon_) }; symbol_post_it != state_post.end();
+                 ++symbol_post_it) {
+                for (const State target: symbol_post_it->targets) {
+                    if (mark(target)) { stack_.push_back(target); }
+                }
+            }
+        }
+        std::sort(closure.begin(), closure.end());
+        closures_[state] = std::move(closure);
+        computed_[state] = true;
+    }
+}; // class EpsilonClosures.
+
+/**
+ * Determinize @p aut, which is either @c Nfa or @c FrozenNfa, by the subset construction.
+ *
+ * Each macrostate is interned in a @c SetArena exactly once. Its handle is the state of the determinized automaton,
+ *  so the worklist keeps only handles and no map from macrostates to states is needed.
+ */
+template<class Automaton>
+Nfa subset_construction(
+    const Automaton& aut, std::unordered_map<StateSet, State>* subset_map,
+    const std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>>& macrostate_discover,
+    const std::optional<Symbol> first_epsilon
 ) {
+    using MacrostateArena = SetArena<State>;
+    using Handle = MacrostateArena::Handle;
     Nfa result{};
+    std::optional<EpsilonClosures<std::remove_cvref_t<decltype(aut.delta)>>> epsilon_closures{};
+    if (first_epsilon.has_value()) { epsilon_closures.emplace(aut.delta, *first_epsilon); }
     //assuming all sets targets are non-empty
-    std::vector<std::pair<State, StateSet>> worklist{};
-    std::unordered_map<StateSet, State> subset_map_local{};
-    if (subset_map == nullptr) { subset_map = &subset_map_local; }
+    std::vector<Handle> worklist{};
+    MacrostateArena macrostates{};
+    auto to_state_set = [&](const Handle handle) {
+        const std::span<const State> macrostate{ macrostates[handle] };
+        StateSet state_set{};
+        state_set.reserve(macrostate.size());
+        for (const State state: macrostate) { state_set.push_back(state); }
+        return state_set;
+    };
+    // Macrostates are converted to StateSet only when a caller asks for them.
+    auto fill_subset_map = [&]() {
+        if (subset_map == nullptr) { return; }
+        for (Handle handle{ 0 }; handle < macrostates.size(); ++handle) { (*subset_map)[to_state_set(handle)] = handle; }
+    };
 
-    const StateSet S0{ aut.initial };
+    StateSet S0{ aut.initial };
+    if (epsilon_closures.has_value()) { S0 = epsilon_closures->close(S0); }
     const State S0id{ result.add_state() };
     result.initial.insert(S0id);
 
     if (aut.final.intersects_with(S0)) {
         result.final.insert(S0id);
     }
-    worklist.emplace_back(S0id, S0);
-    (*subset_map)[mata::utils::OrdVector<State>(S0)] = S0id;
-    if (aut.delta.empty()) { return result; }
-    if (macrostate_discover.has_value() && !(*macrostate_discover)(result, S0id, S0)) { return result; }
+    macrostates.insert({ S0.data(), S0.size() });
+    worklist.push_back(static_cast<Handle>(S0id));
+    if (aut.delta.empty()
+        || (macrostate_discover.has_value() && !(*macrostate_discover)(result, S0id, S0))) {
+        fill_subset_map();
+        return result;
+    }
 
-    using Iterator = mata::utils::OrdVector<SymbolPost>::const_iterator;
-    SynchronizedExistentialSymbolPostIterator synchronized_iterator;
+    using SynchronizedIterator = SynchronizedExistentialSymbolPostIteratorOf<decltype(aut.delta)>;
+    using Iterator = std::remove_cvref_t<decltype(aut.delta[0])>::const_iterator;
+    SynchronizedIterator synchronized_iterator;
+    std::vector<State> T{};
 
     while (!worklist.empty()) {
-        const auto Spair = worklist.back();
+        const State Sid{ worklist.back() };
         worklist.pop_back();
-        const StateSet S = Spair.second;
-        const State Sid = Spair.first;
+        // The view is invalidated by interning new macrostates below, it is used only to initialize the iterator.
+        const std::span<const State> S{ macrostates[static_cast<Handle>(Sid)] };
         if (S.empty()) {
             // This should not happen assuming all sets targets are non-empty.
             break;
@@ -1438,27 +1951,378 @@ Nfa mata::nfa::determinize(
             // extract post from the synchronized_iterator iterator
             const std::vector<Iterator>& symbol_posts = synchronized_iterator.get_current();
             Symbol currentSymbol = (*symbol_posts.begin())->symbol;
-            StateSet T = synchronized_iterator.unify_targets();
+            // Epsilon symbols are the largest ones.
+            if (epsilon_closures.has_value() && currentSymbol >= epsilon_closures->first_epsilon()) { break; }
+            size_t T_hash{ unify_targets_into(symbol_posts, T) };
+            if (epsilon_closures.has_value()) { T_hash = epsilon_closures->close(T); }
+
+            const auto [T_handle, is_new_macrostate]{ macrostates.insert(T, T_hash) };
+            const State Tid{ T_handle };
+            if (is_new_macrostate) {
+                result.add_state();
+                assert(Tid + 1 == result.num_of_states());
+                if (std::any_of(T.begin(), T.end(), [&](const State q) { return aut.final.contains(q); })) {
+                    result.final.insert(Tid);
+                }
+                worklist.push_back(T_handle);
+            }
+            result.delta.mutable_state_post(Sid).insert(SymbolPost(currentSymbol, Tid));
+            if (is_new_macrostate && macrostate_discover.has_value()
+                && !(*macrostate_discover)(result, Tid, to_state_set(T_handle))) {
+                fill_subset_map();
+                return result;
+            }
+        }
+    }
+    fill_subset_map();
+    return result;
+}
+
+/**
+ * Determinize @p aut, which is either @c Nfa or @c FrozenNfa, by the subset construction over macrostates represented
+ *  by @c AdaptiveSet.
+ *
+ * Targets of the symbol posts of a macrostate are collected in a bitset instead of merging the sorted target sets.
+ */
+template<class Automaton>
+Nfa adaptive_subset_construction(
+    const Automaton& aut, std::unordered_map<StateSet, State>* subset_map,
+    const std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>>& macrostate_discover,
+    const std::optional<Symbol> first_epsilon
+) {
+    using Macrostate = AdaptiveSet<State>;
+    Nfa result{};
+    std::optional<EpsilonClosures<std::remove_cvref_t<decltype(aut.delta)>>> epsilon_closures{};
+    if (first_epsilon.has_value()) { epsilon_closures.emplace(aut.delta, *first_epsilon); }
+    std::vector<std::pair<State, Macrostate>> worklist{};
+    std::unordered_map<Macrostate, State> macrostate_map{};
+    Macrostate::Builder builder{ aut.num_of_states() };
+    // Macrostates are converted to StateSet only when a caller asks for them.
+    auto fill_subset_map = [&]() {
+        if (subset_map == nullptr) { return; }
+        for (const auto& [macrostate, macrostate_id]: macrostate_map) {
+            (*subset_map)[macrostate.to_ord_vector()] = macrostate_id;
+        }
+    };
+
+    const Macrostate S0{ epsilon_closures.has_value() ? epsilon_closures->close(StateSet{ aut.initial })
+                                                      : StateSet{ aut.initial } };
+    const State S0id{ result.add_state() };
+    result.initial.insert(S0id);
+
+    if (S0.intersects_with(aut.final)) {
+        result.final.insert(S0id);
+    }
+    worklist.emplace_back(S0id, S0);
+    macrostate_map.emplace(S0, S0id);
+    if (aut.delta.empty()
+        || (macrostate_discover.has_value() && !(*macrostate_discover)(result, S0id, S0.to_ord_vector()))) {
+        fill_subset_map();
+        return result;
+    }
+
+    using SynchronizedIterator = SynchronizedExistentialSymbolPostIteratorOf<decltype(aut.delta)>;
+    using Iterator = std::remove_cvref_t<decltype(aut.delta[0])>::const_iterator;
+    SynchronizedIterator synchronized_iterator;
+
+    while (!worklist.empty()) {
+        const auto [Sid, S]{ std::move(worklist.back()) };
+        worklist.pop_back();
+        if (S.empty()) {
+            // This should not happen assuming all sets targets are non-empty.
+            break;
+        }
+
+        synchronized_iterator.reset();
+        for (const State q: S) {
+            mata::utils::push_back(synchronized_iterator, aut.delta[q]);
+        }
 
-            const auto existingTitr = subset_map->find(T);
-            State Tid;
-            if (existingTitr != subset_map->end()) {
-                Tid = existingTitr->second;
+        while (synchronized_iterator.advance()) {
+            const std::vector<Iterator>& symbol_posts = synchronized_iterator.get_current();
+            const Symbol currentSymbol = (*symbol_posts.begin())->symbol;
+            if (epsilon_closures.has_value()) {
+                // Epsilon symbols are the largest ones.
+                if (currentSymbol >= epsilon_closures->first_epsilon()) { break; }
+                for (const Iterator& symbol_post: symbol_posts) {
+                    for (const State target: symbol_post->targets) { builder.insert(epsilon_closures->of(target)); }
+                }
             } else {
-                Tid = result.add_state();
-                (*subset_map)[mata::utils::OrdVector<State>(T)] = Tid;
-                if (aut.final.intersects_with(T)) {
+                for (const Iterator& symbol_post: symbol_posts) { builder.insert(symbol_post->targets); }
+            }
+            Macrostate T{ builder.build() };
+
+            auto existingTitr = macrostate_map.find(T);
+            const bool is_new_macrostate{ existingTitr == macrostate_map.end() };
+            if (is_new_macrostate) {
+                const State Tid{ result.add_state() };
+                if (T.intersects_with(aut.final)) {
                     result.final.insert(Tid);
                 }
-                worklist.emplace_back(Tid, T);
+                existingTitr = macrostate_map.emplace(T, Tid).first;
+                worklist.emplace_back(Tid, std::move(T));
             }
+            const State Tid{ existingTitr->second };
             result.delta.mutable_state_post(Sid).insert(SymbolPost(currentSymbol, Tid));
-            if (macrostate_discover.has_value() && existingTitr == subset_map->end()
-                && !(*macrostate_discover)(result, Tid, T)) { return result; }
+            if (is_new_macrostate && macrostate_discover.has_value()
+                && !(*macrostate_discover)(result, Tid, existingTitr->first.to_ord_vector())) {
+                fill_subset_map();
+                return result;
+            }
+        }
+    }
+    fill_subset_map();
+    return result;
+}
+
+/**
+ * Determinize @p aut, which is either @c Nfa or @c FrozenNfa, by the subset construction run by @p num_of_threads
+ *  threads.
+ *
+ * Macrostates are interned in a table of @c SetArena shards selected by the hash of the macrostate, each shard guarded
+ *  by its own mutex. A newly interned macrostate is given the next free state and becomes a task of the thread which
+ *  found it; idle threads steal tasks from the others (@c WorkStealingQueues). Each thread collects the transitions
+ *  and final states it finds in its own buffers, which are merged at the end. The states are then renumbered in the
+ *  order in which the sequential @c subset_construction() discovers the macrostates, hence the result is the same as
+ *  the result of the sequential construction.
+ */
+template<class Automaton>
+Nfa parallel_subset_construction(
+    const Automaton& aut, std::unordered_map<StateSet, State>* subset_map, const size_t num_of_threads,
+    const std::optional<Symbol> first_epsilon
+) {
+    using Closures = EpsilonClosures<std::remove_cvref_t<decltype(aut.delta)>>;
+    using MacrostateArena = SetArena<State>;
+    using Handle = MacrostateArena::Handle;
+    constexpr size_t NUM_OF_SHARDS{ 64 };
+    constexpr State NO_STATE{ std::numeric_limits<State>::max() };
+
+    /// A shard of the macrostate table.
+    struct alignas(64) Shard {
+        std::mutex mutex{};
+        MacrostateArena macrostates{};
+        std::vector<State> states{}; ///< States of the macrostates, indexed by their handles.
+    };
+    /// A macrostate to explore.
+    struct Task {
+        State state;
+        std::vector<State> macrostate;
+    };
+    /// Transitions and final states found by a single thread.
+    struct ThreadResult {
+        std::vector<Transition> transitions{};
+        std::vector<State> final_states{};
+    };
+
+    std::vector<Shard> shards(NUM_OF_SHARDS);
+    std::atomic<State> num_of_macrostates{ 0 };
+    // Intern @p macrostate with @p hash.
+    // Returns the state of the macrostate and whether the macrostate is new.
+    auto intern = [&](const std::vector<State>& macrostate, const size_t hash) -> std::pair<State, bool> {
+        Shard& shard{ shards[(hash >> 16) % NUM_OF_SHARDS] };
+        const std::lock_guard lock{ shard.mutex };
+        const auto [handle, is_new_macrostate]{ shard.macrostates.insert(macrostate, hash) };
+        if (!is_new_macrostate) { return { shard.states[handle], false }; }
+        const State state{ num_of_macrostates.fetch_add(1, std::memory_order_relaxed) };
+        shard.states.push_back(state);
+        return { state, true };
+    };
+    auto is_final = [&](const std::vector<State>& macrostate) {
+        return std::any_of(macrostate.begin(), macrostate.end(), [&](const State q) { return aut.final.contains(q); });
+    };
+
+    std::vector<State> S0(aut.initial.begin(), aut.initial.end());
+    std::sort(S0.begin(), S0.end());
+    if (first_epsilon.has_value()) { Closures{ aut.delta, *first_epsilon }.close(S0); }
+    intern(S0, MacrostateArena::hash(S0));
+    std::vector<ThreadResult> thread_results(num_of_threads);
+    if (is_final(S0)) { thread_results[0].final_states.push_back(0); }
+
+    if (!S0.empty() && !aut.delta.empty()) {
+        WorkStealingQueues<Task> queues{ num_of_threads };
+        queues.push(0, Task{ 0, std::move(S0) });
+        std::vector<std::exception_ptr> exceptions(num_of_threads);
+        auto explore = [&](const size_t thread) {
+            using SynchronizedIterator = SynchronizedExistentialSymbolPostIteratorOf<decltype(aut.delta)>;
+            using Iterator = std::remove_cvref_t<decltype(aut.delta[0])>::const_iterator;
+            SynchronizedIterator synchronized_iterator;
+            std::vector<State> T{};
+            ThreadResult& thread_result{ thread_results[thread] };
+            // Each thread memoizes its own epsilon closures.
+            std::optional<Closures> epsilon_closures{};
+            if (first_epsilon.has_value()) { epsilon_closures.emplace(aut.delta, *first_epsilon); }
+            try {
+                while (std::optional<Task> task{ queues.pop(thread) }) {
+                    synchronized_iterator.reset();
+                    for (const State q: task->macrostate) { mata::utils::push_back(synchronized_iterator, aut.delta[q]); }
+                    while (synchronized_iterator.advance()) {
+                        const std::vector<Iterator>& symbol_posts = synchronized_iterator.get_current();
+                        const Symbol symbol{ (*symbol_posts.begin())->symbol };
+                        if (epsilon_closures.has_value() && symbol >= epsilon_closures->first_epsilon()) { break; }
+                        size_t T_hash{ unify_targets_into(symbol_posts, T) };
+                        if (epsilon_closures.has_value()) { T_hash = epsilon_closures->close(T); }
+                        const auto [Tid, is_new_macrostate]{ intern(T, T_hash) };
+                        if (is_new_macrostate) {
+                            if (is_final(T)) { thread_result.final_states.push_back(Tid); }
+                            queues.push(thread, Task{ Tid, T });
+                        }
+                        thread_result.transitions.emplace_back(task->state, symbol, Tid);
+                    }
+                    queues.task_done();
+                }
+            } catch (...) {
+                exceptions[thread] = std::current_exception();
+                queues.cancel();
+            }
+        };
+        {
+            std::vector<std::jthread> workers{};
+            workers.reserve(num_of_threads - 1);
+            for (size_t thread{ 1 }; thread < num_of_threads; ++thread) { workers.emplace_back(explore, thread); }
+            explore(0);
+        } // Joins the workers.
+        for (const std::exception_ptr& exception: exceptions) {
+            if (exception) { std::rethrow_exception(exception); }
+        }
+    }
+
+    // Merge the results of the threads.
+    const size_t num_of_states{ num_of_macrostates.load() };
+    Delta delta{};
+    std::vector<Transition> transitions{};
+    for (ThreadResult& thread_result: thread_results) {
+        transitions.insert(transitions.end(), thread_result.transitions.begin(), thread_result.transitions.end());
+        thread_result.transitions = {};
+    }
+    delta.add_bulk(std::move(transitions));
+
+    // Renumber the states in the order of the sequential subset construction: the worklist is a stack and targets of
+    //  a macrostate are discovered in the order of symbols.
+    std::vector<State> renaming(num_of_states, NO_STATE);
+    renaming[0] = 0;
+    State next_state{ 1 };
+    std::vector<State> worklist{ 0 };
+    while (!worklist.empty()) {
+        const State state{ worklist.back() };
+        worklist.pop_back();
+        delta.for_each_move(state, [&](Symbol, const State target) {
+            if (renaming[target] == NO_STATE) {
+                renaming[target] = next_state++;
+                worklist.push_back(target);
+            }
+        });
+    }
+
+    Nfa result{ num_of_states };
+    result.initial.insert(0);
+    // The sequential construction inserts final states in the order of their discovery.
+    std::vector<State> final_states{};
+    for (const ThreadResult& thread_result: thread_results) {
+        for (const State final_state: thread_result.final_states) { final_states.push_back(renaming[final_state]); }
+    }
+    std::sort(final_states.begin(), final_states.end());
+    for (const State final_state: final_states) { result.final.insert(final_state); }
+    for (State source{ 0 }; source < delta.num_of_states(); ++source) {
+        StatePost& state_post{ result.delta.mutable_state_post(renaming[source]) };
+        for (const SymbolPost& symbol_post: delta[source]) {
+            state_post.push_back(SymbolPost{ symbol_post.symbol, renaming[symbol_post.targets.front()] });
+        }
+    }
+    if (subset_map != nullptr) {
+        for (const Shard& shard: shards) {
+            for (Handle handle{ 0 }; handle < shard.macrostates.size(); ++handle) {
+                const std::span<const State> macrostate{ shard.macrostates[handle] };
+                (*subset_map)[StateSet(std::vector<State>(macrostate.begin(), macrostate.end()))]
+                    = renaming[shard.states[handle]];
+            }
         }
     }
     return result;
 }
+} // namespace
+
+std::optional<Symbol> mata::nfa::algorithms::get_first_epsilon(const ParameterMap& params) {
+    if (!haskey(params, "first_epsilon")) { return std::nullopt; }
+    const std::string& first_epsilon{ params.at("first_epsilon") };
+    size_t num_of_parsed_characters{ 0 };
+    unsigned long long symbol{ 0 };
+    try {
+        symbol = std::stoull(first_epsilon, &num_of_parsed_characters);
+    } catch (const std::logic_error&) { num_of_parsed_characters = 0; }
+    if (num_of_parsed_characters == 0 || num_of_parsed_characters != first_epsilon.size()
+        || symbol > std::numeric_limits<Symbol>::max()) {
+        throw std::runtime_error(std::to_string(__func__) +
+                                 " received an invalid value of the \"first_epsilon\" key: " + first_epsilon);
+    }
+    return static_cast<Symbol>(symbol);
+}
+
+size_t mata::nfa::algorithms::get_num_of_threads(const ParameterMap& params) {
+    if (!haskey(params, "threads")) { return 1; }
+    const std::string& threads{ params.at("threads") };
+    size_t num_of_parsed_characters{ 0 };
+    size_t num_of_threads{ 0 };
+    try {
+        num_of_threads = std::stoul(threads, &num_of_parsed_characters);
+    } catch (const std::logic_error&) { num_of_parsed_characters = 0; }
+    if (num_of_parsed_characters == 0 || num_of_parsed_characters != threads.size()) {
+        throw std::runtime_error(std::to_string(__func__) +
+                                 " received an invalid value of the \"threads\" key: " + threads);
+    }
+    if (num_of_threads == 0) { return std::max(std::thread::hardware_concurrency(), 1u); }
+    return num_of_threads;
+}
+
+bool mata::nfa::algorithms::use_adaptive_macrostates(const ParameterMap& params) {
+    if (!haskey(params, "macrostate")) { return false; }
+    const std::string& macrostate{ params.at("macrostate") };
+    if ("adaptive" == macrostate) { return true; }
+    if ("sorted-vector" == macrostate) { return false; }
+    throw std::runtime_error(std::to_string(__func__) +
+                             " received an unknown value of the \"macrostate\" key: " + macrostate);
+}
+
+Nfa mata::nfa::determinize(
+    const Nfa&  aut, std::unordered_map<StateSet, State>* subset_map,
+    std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>> macrostate_discover,
+    const ParameterMap& params
+) {
+    const size_t num_of_threads{ algorithms::get_num_of_threads(params) };
+    const std::optional<Symbol> first_epsilon{ algorithms::get_first_epsilon(params) };
+    if (algorithms::use_adaptive_macrostates(params)) {
+        if (num_of_threads > 1) {
+            throw std::runtime_error(std::to_string(__func__) +
+                                     " supports only \"sorted-vector\" macrostates with more than one thread");
+        }
+        return adaptive_subset_construction(aut, subset_map, macrostate_discover, first_epsilon);
+    }
+    // The callback observes the determinized automaton during the construction, which needs a sequential order.
+    if (num_of_threads > 1 && !macrostate_discover.has_value()) {
+        return parallel_subset_construction(aut, subset_map, num_of_threads, first_epsilon);
+    }
+    return subset_construction(aut, subset_map, macrostate_discover, first_epsilon);
+}
+
+Nfa mata::nfa::determinize(
+    const FrozenNfa& aut, std::unordered_map<StateSet, State>* subset_map,
+    std::optional<std::function<bool(const Nfa&, const State, const StateSet&)>> macrostate_discover,
+    const ParameterMap& params
+) {
+    const size_t num_of_threads{ algorithms::get_num_of_threads(params) };
+    const std::optional<Symbol> first_epsilon{ algorithms::get_first_epsilon(params) };
+    if (algorithms::use_adaptive_macrostates(params)) {
+        if (num_of_threads > 1) {
+            throw std::runtime_error(std::to_string(__func__) +
+                                     " supports only \"sorted-vector\" macrostates with more than one thread");
+        }
+        return adaptive_subset_construction(aut, subset_map, macrostate_discover, first_epsilon);
+    }
+    // The callback observes the determinized automaton during the construction, which needs a sequential order.
+    if (num_of_threads > 1 && !macrostate_discover.has_value()) {
+        return parallel_subset_construction(aut, subset_map, num_of_threads, first_epsilon);
+    }
+    return subset_construction(aut, subset_map, macrostate_discover, first_epsilon);
+}
 
 std::ostream& std::operator<<(std::ostream& os, const Nfa& nfa) {
     nfa.print_to_mata(os);
@@ -1561,7 +2425,7 @@ std::optional<mata::Word> Nfa::get_word(const Symbol first_epsilon) const {
     if (initial.intersects_with(final)) { return Word{}; }
 
     /// Current state state post iterator, its end iterator, and iterator in the current symbol post to target states.
-    std::vector<std::tuple<StatePost::const_iterator, StatePost::const_iterator, StateSet::const_iterator>> worklist{};
+    std::vector<std::tuple<StatePost::const_iterator, StatePost::const_iterator, TargetSet::const_iterator>> worklist{};
     std::vector<bool> searched(num_of_states(), false);
     bool final_found{};
     for (const State initial_state: initial) {
@@ -1639,7 +2503,7 @@ std::optional<mata::Word> Nfa::get_word_from_complement(const Alphabet* alphabet
     auto subset_map_it{ subset_map.emplace(initial, new_initial).first };
     worklist.emplace_back(subset_map_it.operator->());
 
-    using Iterator = mata::utils::OrdVector<SymbolPost>::const_iterator;
+    using Iterator = StatePost::const_iterator;
     SynchronizedExistentialSymbolPostIterator synchronized_iterator{};
 
     const utils::OrdVector<Symbol> symbols{ get_symbols_to_work_with(*this, alphabet) };
@@ -1708,8 +2572,22 @@ Nfa mata::nfa::lang_difference(
     const Nfa& nfa_included, const Nfa& nfa_excluded,
     std::optional<
         std::function<bool(const Nfa&, const Nfa&, const StateSet&, const StateSet&, const State, const Nfa&)>
-    > macrostate_discover
+    > macrostate_discover,
+    const std::optional<Symbol> first_epsilon
 ) {
+    std::optional<EpsilonClosures<Delta>> epsilon_closures_included{};
+    std::optional<EpsilonClosures<Delta>> epsilon_closures_excluded{};
+    if (first_epsilon.has_value()) {
+        epsilon_closures_included.emplace(nfa_included.delta, *first_epsilon);
+        epsilon_closures_excluded.emplace(nfa_excluded.delta, *first_epsilon);
+    }
+    auto close_included = [&](StateSet states) {
+        return epsilon_closures_included.has_value() ? epsilon_closures_included->close(states) : states;
+    };
+    auto close_excluded = [&](StateSet states) {
+        return epsilon_closures_excluded.has_value() ? epsilon_closures_excluded->close(states) : states;
+    };
+
     std::unordered_set<StateSet> subset_set_included{};
     std::unordered_set<StateSet> subset_set_excluded{};
     using SubsetMacrostateMap = std::unordered_map<std::pair<
@@ -1725,14 +2603,16 @@ Nfa mata::nfa::lang_difference(
     Nfa nfa_lang_difference{};
     const State new_initial{ nfa_lang_difference.add_state() };
     nfa_lang_difference.initial.insert(new_initial);
-    if (nfa_included.final.intersects_with(nfa_included.initial) &&
-        !nfa_excluded.final.intersects_with(nfa_excluded.initial)) {
+    StateSet initial_included{ close_included(StateSet{ nfa_included.initial }) };
+    StateSet initial_excluded{ close_excluded(StateSet{ nfa_excluded.initial }) };
+    if (nfa_included.final.intersects_with(initial_included) &&
+        !nfa_excluded.final.intersects_with(initial_excluded)) {
         nfa_lang_difference.final.insert(new_initial);
     }
     auto subset_set_included_ptr{
-        subset_set_included.emplace(nfa_included.initial).first.operator->() };
+        subset_set_included.emplace(std::move(initial_included)).first.operator->() };
     auto subset_set_excluded_ptr{
-        subset_set_excluded.emplace(nfa_excluded.initial).first.operator->() };
+        subset_set_excluded.emplace(std::move(initial_excluded)).first.operator->() };
     auto subset_macrostate_map_ptr{
         subset_macrostate_map.emplace(
             std::make_pair(subset_set_included_ptr, subset_set_excluded_ptr), new_initial).first.operator->() };
@@ -1744,7 +2624,7 @@ Nfa mata::nfa::lang_difference(
             new_initial, nfa_lang_difference)
     ) { return nfa_lang_difference; }
 
-    using Iterator = mata::utils::OrdVector<SymbolPost>::const_iterator;
+    using Iterator = StatePost::const_iterator;
     SynchronizedExistentialSymbolPostIterator synchronized_iterator_included{};
     SynchronizedExistentialSymbolPostIterator synchronized_iterator_excluded{};
 
@@ -1770,10 +2650,12 @@ Nfa mata::nfa::lang_difference(
         while (sync_it_included_advanced) {
             const std::vector<Iterator>& orig_symbol_posts{ synchronized_iterator_included.get_current() };
             const Symbol symbol_advanced_to{ (*orig_symbol_posts.begin())->symbol };
-            StateSet orig_targets_included{ synchronized_iterator_included.unify_targets() };
+            // Epsilon symbols are the largest ones.
+            if (first_epsilon.has_value() && symbol_advanced_to >= *first_epsilon) { break; }
+            StateSet orig_targets_included{ close_included(synchronized_iterator_included.unify_targets()) };
             sync_it_excluded_advanced = synchronized_iterator_excluded.synchronize_with(symbol_advanced_to);
             StateSet orig_targets_excluded{
-                sync_it_excluded_advanced ? synchronized_iterator_excluded.unify_targets() : StateSet{}
+                sync_it_excluded_advanced ? close_excluded(synchronized_iterator_excluded.unify_targets()) : StateSet{}
             };
             const bool final_included_intersects_targets{ nfa_included.final.intersects_with(orig_targets_included) };
             const bool final_excluded_intersects_targets{ nfa_excluded.final.intersects_with(orig_targets_excluded) };
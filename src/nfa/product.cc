@@ -6,9 +6,13 @@
 #include "mata/nfa/algorithms.hh"
 #include <cassert>
 #include <functional>
+#include <bit>
+#include <span>
+#include <queue>
 
 
 using namespace mata::nfa;
+using mata::Symbol;
 
 namespace {
 
@@ -18,14 +22,13 @@ using VecMapProductStorage = std::vector<std::unordered_map<State,State>>;
 using InvertedProductStorage = std::vector<State>;
 //Unordered map seems to be faster than ordered map here, but still very much slower than matrix.
 
-} // Anonymous namespace.
-
-namespace mata::nfa {
-
-//TODO: move this method to nfa.hh? It is something one might want to use (e.g. for union, inclusion, equivalence of DFAs).
-Nfa mata::nfa::algorithms::product(
-        const Nfa& lhs, const Nfa& rhs, const std::function<bool(State,State)>&& final_condition,
-        const Symbol first_epsilon, ProductMap *product_map) {
+/**
+ * Compute product of @p lhs and @p rhs, which are either both @c Nfa or both @c FrozenNfa.
+ */
+template<class Automaton>
+Nfa compute_product(const Automaton& lhs, const Automaton& rhs, const std::function<bool(State,State)>& final_condition,
+            const Symbol first_epsilon, ProductMap *product_map) {
+    using StatePostType = std::remove_cvref_t<decltype(lhs.delta[0])>;
 
     Nfa product{}; // The product automaton.
 
@@ -164,12 +167,12 @@ Nfa mata::nfa::algorithms::product(
         State rhs_source =  product_to_rhs[product_source];
         // Compute classic product for current state pair.
 
-        mata::utils::SynchronizedUniversalIterator<mata::utils::OrdVector<SymbolPost>::const_iterator> sync_iterator(2);
+        mata::utils::SynchronizedUniversalIterator<typename StatePostType::const_iterator> sync_iterator(2);
         mata::utils::push_back(sync_iterator, lhs.delta[lhs_source]);
         mata::utils::push_back(sync_iterator, rhs.delta[rhs_source]);
 
         while (sync_iterator.advance()) {
-            const std::vector<StatePost::const_iterator>& same_symbol_posts{ sync_iterator.get_current() };
+            const std::vector<typename StatePostType::const_iterator>& same_symbol_posts{ sync_iterator.get_current() };
             assert(same_symbol_posts.size() == 2); // One move per state in the pair.
 
             // Compute product for state transitions with same symbols.
@@ -194,7 +197,7 @@ Nfa mata::nfa::algorithms::product(
         }
 
         // Add epsilon transitions, from lhs e-transitions.
-        const StatePost& lhs_state_post{lhs.delta[lhs_source] };
+        const StatePostType& lhs_state_post{lhs.delta[lhs_source] };
 
         //TODO: handling of epsilons might not be ideal, don't know, it would need some brain cycles to improve.
         // (handling of normal symbols is ok though)
@@ -210,7 +213,7 @@ Nfa mata::nfa::algorithms::product(
         }
 
         // Add epsilon transitions, from rhs e-transitions.
-        const StatePost& rhs_state_post{rhs.delta[rhs_source] };
+        const StatePostType& rhs_state_post{rhs.delta[rhs_source] };
         auto rhs_first_epsilon_it = rhs_state_post.first_epsilon_it(first_epsilon);
         if (rhs_first_epsilon_it != rhs_state_post.end()) {
             for (auto rhs_symbol_post = rhs_first_epsilon_it; rhs_symbol_post < rhs_state_post.end(); ++rhs_symbol_post) {
@@ -223,6 +226,442 @@ Nfa mata::nfa::algorithms::product(
         }
     }
     return product;
-} // intersection().
+} // compute_product().
+
+/**
+ * Maps tuples of states of the multiplied NFAs to product states.
+ *
+ * The tuples are stored one after another in a single vector indexed by the product state. Product states are looked
+ *  up in a trie of dense blocks: the i-th level maps the (numbered) prefixes of the tuples of length i and the states of
+ *  the i-th NFA to the prefixes of length i+1, the last level to product states. A block of the next level is allocated
+ *  only for prefixes which are really reached, so for two NFAs, this is the matrix of the binary product.
+ * When the dense blocks would take more than @c MAX_DENSE_SIZE cells, the map switches to an open-addressing hash table
+ *  with linear probing, keeping product states together with the hashes of their tuples.
+ */
+class TupleMap {
+public:
+    /// The largest number of cells of dense blocks to allocate (as the matrix in the binary product).
+    static constexpr size_t MAX_DENSE_SIZE = 50'000'000;
+
+    explicit TupleMap(const std::vector<size_t>& num_of_states)
+        : arity_{ num_of_states.size() }, radixes_{ num_of_states }, levels_(arity_), num_of_prefixes_(arity_) {
+        if (!allocate_block(0)) { switch_to_table(); }
+    }
+
+    size_t size() const { return tuples_.size() / arity_; }
+
+    std::span<const State> operator[](const State product_state) const {
+        return { tuples_.data() + product_state * arity_, arity_ };
+    }
+
+    /**
+     * Get the product state of @p tuple, adding a new product state numbered @c size() if there is none yet.
+     * @return The product state and whether it was added.
+     */
+    std::pair<State, bool> insert(const std::vector<State>& tuple) {
+        assert(tuple.size() == arity_);
+        if (table_.empty()) {
+            State prefix{ 0 };
+            size_t level{ 0 };
+            for (; level + 1 < arity_; ++level) {
+                State& next_prefix{ levels_[level][prefix * radixes_[level] + tuple[level]] };
+                if (next_prefix == Limits::max_state) {
+                    if (!allocate_block(level + 1)) { break; }
+                    next_prefix = num_of_prefixes_[level]++;
+                }
+                prefix = next_prefix;
+            }
+            if (level + 1 == arity_) {
+                State& product_state{ levels_[level][prefix * radixes_[level] + tuple[level]] };
+                if (product_state != Limits::max_state) { return { product_state, false }; }
+                product_state = size();
+                tuples_.insert(tuples_.end(), tuple.begin(), tuple.end());
+                return { product_state, true };
+            }
+            switch_to_table();
+        }
+
+        // Keep the load factor at most 1/2.
+        if (2 * (size() + 1) > table_.size()) { grow_table(); }
+        const size_t hash{ mata::utils::hash_range(tuple.begin(), tuple.end()) };
+        size_t index{ bucket(hash) };
+        // Tuples are compared only when their hashes match.
+        while (table_[index].second != Limits::max_state) {
+            if (table_[index].first == hash) {
+                const std::span<const State> stored{ (*this)[table_[index].second] };
+                if (std::equal(stored.begin(), stored.end(), tuple.begin())) { return { table_[index].second, false }; }
+            }
+            index = (index + 1) & (table_.size() - 1);
+        }
+        table_[index] = { hash, size() };
+        tuples_.insert(tuples_.end(), tuple.begin(), tuple.end());
+        return { table_[index].second, true };
+    }
+
+private:
+    static constexpr size_t MIN_TABLE_SIZE = 1024;
+
+    /// Allocate a dense block for a new prefix at @p level, unless the dense blocks would get too large.
+    bool allocate_block(const size_t level) {
+        if (radixes_[level] > MAX_DENSE_SIZE - dense_size_) { return false; }
+        dense_size_ += radixes_[level];
+        levels_[level].resize(levels_[level].size() + radixes_[level], Limits::max_state);
+        return true;
+    }
+
+    /// Release the dense blocks and insert all the product states into the hash table.
+    void switch_to_table() {
+        levels_.clear();
+        levels_.shrink_to_fit();
+        table_.resize(MIN_TABLE_SIZE / 2, { 0, Limits::max_state });
+        grow_table();
+    }
+
+    /// The first slot of the hash table to probe for @p hash (Fibonacci hashing).
+    size_t bucket(const size_t hash) const {
+        return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ULL) >> (64 - std::countr_zero(table_.size())));
+    }
+
+    /// Double the size of the hash table (at least to fit all the product states), inserting them again.
+    void grow_table() {
+        size_t table_size{ 2 * table_.size() };
+        while (table_size < 2 * (size() + 1)) { table_size *= 2; }
+        table_.assign(table_size, { 0, Limits::max_state });
+        for (State product_state{ 0 }, num_of_product_states{ size() }; product_state < num_of_product_states;
+             ++product_state) {
+            const std::span<const State> tuple{ (*this)[product_state] };
+            const size_t hash{ mata::utils::hash_range(tuple.begin(), tuple.end()) };
+            size_t index{ bucket(hash) };
+            while (table_[index].second != Limits::max_state) { index = (index + 1) & (table_.size() - 1); }
+            table_[index] = { hash, product_state };
+        }
+    }
+
+    const size_t arity_;
+    const std::vector<size_t> radixes_;
+    std::vector<State> tuples_{};
+    /// Dense blocks of the levels of the trie.
+    std::vector<std::vector<State>> levels_;
+    /// Numbers of prefixes of length i+1 reached so far.
+    std::vector<State> num_of_prefixes_;
+    size_t dense_size_{ 0 };
+    /// Pairs of hashes of tuples and their product states, used when the dense blocks get too large.
+    std::vector<std::pair<size_t, State>> table_{};
+}; // class TupleMap.
+
+/**
+ * Enumerates the tuples of the cartesian product of sets of states (@c choices) of the multiplied NFAs.
+ */
+class TupleEnumerator {
+public:
+    /// Choices of states for each of the NFAs.
+    std::vector<std::vector<State>> choices;
+
+    explicit TupleEnumerator(const size_t arity): choices(arity), positions_(arity) {}
+
+    /**
+     * Call @p callback for each tuple of the cartesian product of @c choices, set in @p tuple.
+     * @param[out] tuple Tuple of states to set.
+     * @param[in] callback Returns @c false to stop the enumeration.
+     * @return @c false iff the enumeration was stopped by @p callback.
+     */
+    template<class Callback>
+    bool for_each(std::vector<State>& tuple, Callback&& callback) {
+        const size_t arity{ choices.size() };
+        if (std::any_of(choices.begin(), choices.end(), [](const auto& choice) { return choice.empty(); })) {
+            return true;
+        }
+        for (size_t component{ 0 }; component < arity; ++component) {
+            positions_[component] = 0;
+            tuple[component] = choices[component][0];
+        }
+        size_t component{ 0 };
+        while (component < arity) {
+            if (!callback()) { return false; }
+            for (component = 0; component < arity; ++component) {
+                if (++positions_[component] < choices[component].size()) {
+                    tuple[component] = choices[component][positions_[component]];
+                    break;
+                }
+                positions_[component] = 0;
+                tuple[component] = choices[component][0];
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<size_t> positions_;
+}; // class TupleEnumerator.
+
+} // Anonymous namespace.
+
+namespace mata::nfa {
+
+//TODO: move this method to nfa.hh? It is something one might want to use (e.g. for union, inclusion, equivalence of DFAs).
+Nfa mata::nfa::algorithms::product(
+        const Nfa& lhs, const Nfa& rhs, const std::function<bool(State,State)>&& final_condition,
+        const Symbol first_epsilon, ProductMap *product_map) {
+    return compute_product(lhs, rhs, final_condition, first_epsilon, product_map);
+}
+
+Nfa mata::nfa::algorithms::product(
+        const FrozenNfa& lhs, const FrozenNfa& rhs, const std::function<bool(State,State)>&& final_condition,
+        const Symbol first_epsilon, ProductMap *product_map) {
+    return compute_product(lhs, rhs, final_condition, first_epsilon, product_map);
+}
+
+Nfa mata::nfa::algorithms::product(
+        const std::vector<const Nfa*>& nfas, const std::function<bool(std::span<const State>)>& final_condition,
+        const Symbol first_epsilon, const std::vector<BoolVector>* useful_states) {
+    const size_t arity{ nfas.size() };
+    assert(arity > 0);
+    assert(useful_states == nullptr || useful_states->size() == arity);
+
+    Nfa product{};
+    std::vector<size_t> num_of_states{};
+    for (const Nfa* nfa: nfas) { num_of_states.push_back(nfa->num_of_states()); }
+    TupleMap tuple_map{ num_of_states };
+    std::vector<State> worklist{};
+
+    auto is_useful = [&](const size_t component, const State state) {
+        return useful_states == nullptr || (state < (*useful_states)[component].size()
+                                            && (*useful_states)[component][state]);
+    };
+
+    // The tuple of states to get a product state for.
+    std::vector<State> tuple(arity);
+    auto get_product_state = [&]() {
+        const auto [product_state, inserted]{ tuple_map.insert(tuple) };
+        if (inserted) {
+            product.add_state(product_state);
+            worklist.push_back(product_state);
+            if (final_condition(tuple)) { product.final.insert(product_state); }
+        }
+        return product_state;
+    };
+
+    TupleEnumerator tuples{ arity };
+    std::vector<std::vector<State>>& choices{ tuples.choices };
+
+    for (size_t component{ 0 }; component < arity; ++component) {
+        choices[component].clear();
+        for (const State initial: nfas[component]->initial) {
+            if (is_useful(component, initial)) { choices[component].push_back(initial); }
+        }
+    }
+    tuples.for_each(tuple, [&]() {
+        product.initial.insert(get_product_state());
+        return true;
+    });
+
+    mata::utils::SynchronizedUniversalIterator<StatePost::const_iterator> sync_iterator(arity);
+    std::vector<State> source_tuple(arity);
+    std::vector<State> targets{};
+    std::vector<std::pair<Symbol, State>> epsilon_moves{};
+    while (!worklist.empty()) {
+        const State product_source{ worklist.back() };
+        worklist.pop_back();
+        const std::span<const State> stored_tuple{ tuple_map[product_source] };
+        std::copy(stored_tuple.begin(), stored_tuple.end(), source_tuple.begin());
+
+        // Symbols of all the components are synchronized, the targets are all the tuples of their targets.
+        sync_iterator.reset(arity);
+        for (size_t component{ 0 }; component < arity; ++component) {
+            mata::utils::push_back(sync_iterator, nfas[component]->delta[source_tuple[component]]);
+        }
+        while (sync_iterator.advance()) {
+            const std::vector<StatePost::const_iterator>& same_symbol_posts{ sync_iterator.get_current() };
+            const Symbol symbol{ same_symbol_posts[0]->symbol };
+            if (symbol >= first_epsilon) { break; }
+
+            for (size_t component{ 0 }; component < arity; ++component) {
+                choices[component].clear();
+                for (const State target: same_symbol_posts[component]->targets) {
+                    if (is_useful(component, target)) { choices[component].push_back(target); }
+                }
+            }
+            targets.clear();
+            tuples.for_each(tuple, [&]() {
+                targets.push_back(get_product_state());
+                return true;
+            });
+            if (!targets.empty()) {
+                // Symbols are iterated in order, so the symbol post can be pushed back.
+                product.delta.mutable_state_post(product_source).push_back(
+                    SymbolPost{ symbol, TargetSet(targets.begin(), targets.end()) });
+            }
+        }
+
+        // An ε-transition of a component moves only the component itself.
+        epsilon_moves.clear();
+        tuple = source_tuple;
+        for (size_t component{ 0 }; component < arity; ++component) {
+            const StatePost& state_post{ nfas[component]->delta[source_tuple[component]] };
+            for (auto symbol_post_it{ state_post.first_epsilon_it(first_epsilon) }; symbol_post_it != state_post.end();
+                 ++symbol_post_it) {
+                for (const State target: symbol_post_it->targets) {
+                    if (!is_useful(component, target)) { continue; }
+                    tuple[component] = target;
+                    epsilon_moves.emplace_back(symbol_post_it->symbol, get_product_state());
+                }
+            }
+            tuple[component] = source_tuple[component];
+        }
+        std::sort(epsilon_moves.begin(), epsilon_moves.end());
+        for (auto move_it{ epsilon_moves.begin() }; move_it != epsilon_moves.end();) {
+            const Symbol symbol{ move_it->first };
+            targets.clear();
+            for (; move_it != epsilon_moves.end() && move_it->first == symbol; ++move_it) {
+                targets.push_back(move_it->second);
+            }
+            product.delta.mutable_state_post(product_source).push_back(
+                SymbolPost{ symbol, TargetSet(targets.begin(), targets.end()) });
+        }
+    }
+    return product;
+}
 
 } // namespace mata::nfa.
+
+bool mata::nfa::is_intersection_empty(const std::vector<const Nfa*>& nfas, Run* cex, const ParameterMap& params) {
+    if (nfas.empty()) {
+        throw std::runtime_error(std::to_string(__func__) + " requires at least one NFA");
+    }
+    if (!mata::utils::haskey(params, "algorithm")) {
+        throw std::runtime_error(std::to_string(__func__) +
+                                 " requires setting the \"algorithm\" key in the \"params\" argument; "
+                                 "received: " + std::to_string(params));
+    }
+    const std::string& algorithm{ params.at("algorithm") };
+    if ("dfs" != algorithm && "best-first" != algorithm) {
+        throw std::runtime_error(std::to_string(__func__) +
+                                 " received an unknown value of the \"algorithm\" key: " + algorithm);
+    }
+    const bool best_first{ "best-first" == algorithm };
+
+    if (std::any_of(nfas.begin(), nfas.end(), [](const Nfa* nfa) {
+        return nfa->initial.empty() || nfa->final.empty();
+    })) { return true; }
+
+    const size_t arity{ nfas.size() };
+    // For the best-first search, states which cannot reach a final state are never visited, and tuples are explored
+    //  in the order of the longest of the distances of their states to final states (a lower bound on the length of
+    //  the rest of an accepting run).
+    std::vector<std::vector<State>> distances_to_final{};
+    if (best_first) {
+        distances_to_final.reserve(arity);
+        for (const Nfa* nfa: nfas) { distances_to_final.push_back(nfa->distances_to_final()); }
+    }
+    auto is_viable = [&](const size_t component, const State state) {
+        return !best_first || distances_to_final[component][state] != Limits::max_state;
+    };
+    auto distance_to_final = [&](const std::span<const State> tuple) {
+        State distance{ 0 };
+        for (size_t component{ 0 }; component < arity; ++component) {
+            distance = std::max(distance, distances_to_final[component][tuple[component]]);
+        }
+        return distance;
+    };
+
+    std::vector<size_t> num_of_states{};
+    for (const Nfa* nfa: nfas) { num_of_states.push_back(nfa->num_of_states()); }
+    TupleMap tuple_map{ num_of_states };
+    TupleEnumerator tuples{ arity };
+    std::vector<std::vector<State>>& choices{ tuples.choices };
+
+    std::vector<State> worklist{};
+    using DistanceAndState = std::pair<State, State>;
+    std::priority_queue<DistanceAndState, std::vector<DistanceAndState>, std::greater<>> queue{};
+
+    // 'parents[s] == {t, a}' denotes that product state 's' was discovered from product state 't' over 'a',
+    //  'parents[s] == {s, 0}' means that 's' is an initial product state. Epsilon symbols are not in the witness.
+    std::vector<std::pair<State, Symbol>> parents{};
+    std::vector<State> tuple(arity);
+    auto is_final = [&]() {
+        for (size_t component{ 0 }; component < arity; ++component) {
+            if (!nfas[component]->final.contains(tuple[component])) { return false; }
+        }
+        return true;
+    };
+    // Discover the product state of 'tuple'. Returns false when it is final, the search can stop then.
+    auto discover = [&](const State parent, const Symbol symbol) {
+        const auto [product_state, inserted]{ tuple_map.insert(tuple) };
+        if (!inserted) { return true; }
+        parents.emplace_back(parent == Limits::max_state ? product_state : parent, symbol);
+        if (is_final()) {
+            if (cex != nullptr) {
+                cex->word.clear();
+                cex->path.clear();
+                for (State trav{ product_state }; parents[trav].first != trav; trav = parents[trav].first) {
+                    if (parents[trav].second < EPSILON) { cex->word.push_back(parents[trav].second); }
+                }
+                std::reverse(cex->word.begin(), cex->word.end());
+            }
+            return false;
+        }
+        if (best_first) {
+            queue.emplace(distance_to_final(tuple), product_state);
+        } else {
+            worklist.push_back(product_state);
+        }
+        return true;
+    };
+
+    for (size_t component{ 0 }; component < arity; ++component) {
+        choices[component].clear();
+        for (const State initial: nfas[component]->initial) {
+            if (is_viable(component, initial)) { choices[component].push_back(initial); }
+        }
+    }
+    if (!tuples.for_each(tuple, [&]() { return discover(Limits::max_state, 0); })) { return false; }
+
+    mata::utils::SynchronizedUniversalIterator<StatePost::const_iterator> sync_iterator(arity);
+    std::vector<State> source_tuple(arity);
+    while (!worklist.empty() || !queue.empty()) {
+        State product_source;
+        if (best_first) {
+            product_source = queue.top().second;
+            queue.pop();
+        } else {
+            product_source = worklist.back();
+            worklist.pop_back();
+        }
+        const std::span<const State> stored_tuple{ tuple_map[product_source] };
+        std::copy(stored_tuple.begin(), stored_tuple.end(), source_tuple.begin());
+
+        sync_iterator.reset(arity);
+        for (size_t component{ 0 }; component < arity; ++component) {
+            mata::utils::push_back(sync_iterator, nfas[component]->delta[source_tuple[component]]);
+        }
+        while (sync_iterator.advance()) {
+            const std::vector<StatePost::const_iterator>& same_symbol_posts{ sync_iterator.get_current() };
+            const Symbol symbol{ same_symbol_posts[0]->symbol };
+            if (symbol >= EPSILON) { break; }
+
+            for (size_t component{ 0 }; component < arity; ++component) {
+                choices[component].clear();
+                for (const State target: same_symbol_posts[component]->targets) {
+                    if (is_viable(component, target)) { choices[component].push_back(target); }
+                }
+            }
+            if (!tuples.for_each(tuple, [&]() { return discover(product_source, symbol); })) { return false; }
+        }
+
+        // An ε-transition of a component moves only the component itself.
+        tuple = source_tuple;
+        for (size_t component{ 0 }; component < arity; ++component) {
+            const StatePost& state_post{ nfas[component]->delta[source_tuple[component]] };
+            for (auto symbol_post_it{ state_post.first_epsilon_it(EPSILON) }; symbol_post_it != state_post.end();
+                 ++symbol_post_it) {
+                for (const State target: symbol_post_it->targets) {
+                    if (!is_viable(component, target)) { continue; }
+                    tuple[component] = target;
+                    if (!discover(product_source, symbol_post_it->symbol)) { return false; }
+                }
+            }
+            tuple[component] = source_tuple[component];
+        }
+    }
+    return true;
+}
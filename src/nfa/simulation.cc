@@ -0,0 +1,307 @@
+/* simulation.cc -- Direct simulations computed over transition relations
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+// MATA headers
+#include "mata/nfa/delta.hh"
+#include "mata/nfa/algorithms.hh"
+
+using namespace mata::nfa;
+using mata::Symbol;
+
+namespace {
+
+/**
+ * Square matrix of bits stored row by row in 64-bit words.
+ */
+class BitMatrix {
+public:
+    using Word = uint64_t;
+    static constexpr size_t WORD_BITS{ 64 };
+
+    explicit BitMatrix(const size_t size)
+        : words_per_row_{ (size + WORD_BITS - 1) / WORD_BITS }, words_(size * words_per_row_, 0) {}
+
+    bool get(const size_t row, const size_t column) const {
+        return (words_[row * words_per_row_ + column / WORD_BITS] >> (column % WORD_BITS)) & 1;
+    }
+
+    void clear(const size_t row, const size_t column) {
+        words_[row * words_per_row_ + column / WORD_BITS] &= ~(Word{ 1 } << (column % WORD_BITS));
+    }
+
+    Word* row(const size_t row) { return words_.data() + row * words_per_row_; }
+    size_t words_per_row() const { return words_per_row_; }
+
+private:
+    size_t words_per_row_;
+    std::vector<Word> words_;
+};
+
+/**
+ * @brief Transitions grouped for the refinement of a direct simulation.
+ *
+ * Transitions are read in the direction of the simulation (reverted for backward simulations) and grouped twice: into
+ *  posts (a source state and a symbol with the targets) and into pres (a target state and a symbol with the sources).
+ *  Each source of a pre refers to the post it belongs to. Each post keeps a counter for every pre over its symbol:
+ *  counters are sized to the numbers of posts and pres over each symbol, not to states times symbols.
+ */
+class SimulationEngine {
+public:
+    template<class DeltaType>
+    SimulationEngine(const DeltaType& delta, const size_t num_of_states, const bool backward)
+        : num_of_states_{ std::max(num_of_states, delta.num_of_states()) } {
+        std::vector<Transition> transitions{};
+        for (State source{ 0 }; source < delta.num_of_states(); ++source) {
+            for (const auto& symbol_post: delta[source]) {
+                for (const State target: symbol_post.targets) {
+                    num_of_states_ = std::max(num_of_states_, static_cast<size_t>(target) + 1);
+                    if (backward) {
+                        transitions.push_back(Transition{ target, symbol_post.symbol, source });
+                    } else {
+                        transitions.push_back(Transition{ source, symbol_post.symbol, target });
+                    }
+                }
+            }
+        }
+        if (backward) {
+            std::sort(transitions.begin(), transitions.end(), [](const Transition& lhs, const Transition& rhs) {
+                return std::tie(lhs.source, lhs.symbol, lhs.target) < std::tie(rhs.source, rhs.symbol, rhs.target);
+            });
+        }
+        build_groups(transitions);
+    }
+
+    /**
+     * Compute the maximal direct simulation where only @p distinguished states simulate @p distinguished states.
+     */
+    Simlib::Util::BinaryRelation compute(const mata::utils::SparseSet<State>& distinguished) {
+        size_t max_post_size{ 0 };
+        for (size_t post{ 0 }; post < post_symbols_.size(); ++post) {
+            max_post_size = std::max(max_post_size, post_offsets_[post + 1] - post_offsets_[post]);
+        }
+        if (max_post_size <= std::numeric_limits<uint8_t>::max()) { return refine<uint8_t>(distinguished); }
+        if (max_post_size <= std::numeric_limits<uint16_t>::max()) { return refine<uint16_t>(distinguished); }
+        return refine<uint32_t>(distinguished);
+    }
+
+private:
+    size_t num_of_states_;
+    size_t num_of_symbols_{ 0 };
+
+    // Posts: the targets of each source state under each symbol, ordered by source states and symbols.
+    std::vector<size_t> state_post_offsets_{}; ///< First post of each state, followed by the number of posts.
+    std::vector<size_t> post_symbols_{}; ///< Index of the symbol of each post (in the order of symbols).
+    std::vector<size_t> post_offsets_{}; ///< First target of each post in @c post_targets_.
+    std::vector<State> post_targets_{};
+    std::vector<size_t> post_counter_offsets_{}; ///< First counter of each post (a counter for each pre of its symbol).
+
+    // Pres: the sources of each target state under each symbol, ordered by target states and symbols.
+    std::vector<size_t> state_pre_offsets_{}; ///< First pre of each state, followed by the number of pres.
+    std::vector<State> pre_states_{}; ///< Target state of each pre.
+    std::vector<size_t> pre_symbols_{};
+    std::vector<size_t> pre_offsets_{}; ///< First source of each pre in @c pre_sources_ and @c pre_source_posts_.
+    std::vector<State> pre_sources_{};
+    std::vector<size_t> pre_source_posts_{}; ///< Post of each source (with the source state and the pre symbol).
+    std::vector<size_t> pre_ranks_{}; ///< Index of each pre among the pres of its symbol.
+    std::vector<std::vector<size_t>> symbol_pres_{}; ///< Pres of each symbol, ordered by their ranks.
+
+    void build_groups(const std::vector<Transition>& transitions) {
+        std::vector<Symbol> symbols{};
+        for (const Transition& transition: transitions) { symbols.push_back(transition.symbol); }
+        std::sort(symbols.begin(), symbols.end());
+        symbols.erase(std::unique(symbols.begin(), symbols.end()), symbols.end());
+        num_of_symbols_ = symbols.size();
+        const auto symbol_index = [&](const Symbol symbol) {
+            return static_cast<size_t>(std::lower_bound(symbols.begin(), symbols.end(), symbol) - symbols.begin());
+        };
+
+        // Posts, from the transitions sorted by sources, symbols and targets.
+        std::vector<size_t> transition_posts(transitions.size());
+        state_post_offsets_.assign(num_of_states_ + 1, 0);
+        for (size_t index{ 0 }; index < transitions.size(); ++index) {
+            const Transition& transition{ transitions[index] };
+            if (index == 0 || transition.source != transitions[index - 1].source
+                || transition.symbol != transitions[index - 1].symbol) {
+                ++state_post_offsets_[transition.source + 1];
+                post_symbols_.push_back(symbol_index(transition.symbol));
+                post_offsets_.push_back(post_targets_.size());
+            }
+            transition_posts[index] = post_symbols_.size() - 1;
+            post_targets_.push_back(transition.target);
+        }
+        post_offsets_.push_back(post_targets_.size());
+        std::partial_sum(state_post_offsets_.begin(), state_post_offsets_.end(), state_post_offsets_.begin());
+
+        // Pres, from the transitions sorted by targets, symbols and sources.
+        std::vector<size_t> order(transitions.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+            return std::tie(transitions[lhs].target, transitions[lhs].symbol, transitions[lhs].source)
+                 < std::tie(transitions[rhs].target, transitions[rhs].symbol, transitions[rhs].source);
+        });
+        state_pre_offsets_.assign(num_of_states_ + 1, 0);
+        symbol_pres_.resize(num_of_symbols_);
+        for (size_t position{ 0 }; position < order.size(); ++position) {
+            const Transition& transition{ transitions[order[position]] };
+            if (position == 0 || transition.target != transitions[order[position - 1]].target
+                || transition.symbol != transitions[order[position - 1]].symbol) {
+                ++state_pre_offsets_[transition.target + 1];
+                pre_states_.push_back(transition.target);
+                const size_t symbol{ symbol_index(transition.symbol) };
+                pre_symbols_.push_back(symbol);
+                pre_offsets_.push_back(pre_sources_.size());
+                pre_ranks_.push_back(symbol_pres_[symbol].size());
+                symbol_pres_[symbol].push_back(pre_symbols_.size() - 1);
+            }
+            pre_sources_.push_back(transition.source);
+            pre_source_posts_.push_back(transition_posts[order[position]]);
+        }
+        pre_offsets_.push_back(pre_sources_.size());
+        std::partial_sum(state_pre_offsets_.begin(), state_pre_offsets_.end(), state_pre_offsets_.begin());
+
+        // Counters of each post: one for each pre over the same symbol.
+        post_counter_offsets_.resize(post_symbols_.size() + 1);
+        size_t num_of_counters{ 0 };
+        for (size_t post{ 0 }; post < post_symbols_.size(); ++post) {
+            post_counter_offsets_[post] = num_of_counters;
+            num_of_counters += symbol_pres_[post_symbols_[post]].size();
+        }
+        post_counter_offsets_.back() = num_of_counters;
+    }
+
+    /**
+     * @brief Refine the relation by counters of simulating successors.
+     *
+     * The counter of a post of q over a and a pre of p' over a is the number of a-successors of q which simulate p'.
+     *  When it drops to zero, no a-successor of q simulates p', so q simulates no a-predecessor p of p'.
+     */
+    template<class Counter>
+    Simlib::Util::BinaryRelation refine(const mata::utils::SparseSet<State>& distinguished) {
+        BitMatrix relation(num_of_states_);
+        initialize(relation, distinguished);
+
+        std::vector<Counter> counters(post_counter_offsets_.back(), 0);
+        for (size_t post{ 0 }; post < post_symbols_.size(); ++post) {
+            const std::vector<size_t>& pres{ symbol_pres_[post_symbols_[post]] };
+            for (size_t rank{ 0 }; rank < pres.size(); ++rank) {
+                const State simulated{ pre_states_[pres[rank]] };
+                Counter count{ 0 };
+                for (size_t position{ post_offsets_[post] }; position < post_offsets_[post + 1]; ++position) {
+                    count = static_cast<Counter>(count + relation.get(simulated, post_targets_[position]));
+                }
+                counters[post_counter_offsets_[post] + rank] = count;
+            }
+        }
+
+        std::vector<std::pair<State, State>> removed{};
+        const auto remove_pres = [&](const size_t pre, const State simulating) {
+            for (size_t position{ pre_offsets_[pre] }; position < pre_offsets_[pre + 1]; ++position) {
+                const State simulated{ pre_sources_[position] };
+                if (relation.get(simulated, simulating)) {
+                    relation.clear(simulated, simulating);
+                    removed.emplace_back(simulated, simulating);
+                }
+            }
+        };
+        for (State state{ 0 }; state < num_of_states_; ++state) {
+            for (size_t post{ state_post_offsets_[state] }; post < state_post_offsets_[state + 1]; ++post) {
+                const std::vector<size_t>& pres{ symbol_pres_[post_symbols_[post]] };
+                for (size_t rank{ 0 }; rank < pres.size(); ++rank) {
+                    if (counters[post_counter_offsets_[post] + rank] == 0) { remove_pres(pres[rank], state); }
+                }
+            }
+        }
+
+        while (!removed.empty()) {
+            const auto [simulated, simulating] = removed.back();
+            removed.pop_back();
+            // For each symbol a with pres of both states, the a-predecessors of 'simulating' lose a successor
+            //  simulating 'simulated'.
+            size_t simulated_pre{ state_pre_offsets_[simulated] };
+            const size_t simulated_pres_end{ state_pre_offsets_[simulated + 1] };
+            size_t simulating_pre{ state_pre_offsets_[simulating] };
+            const size_t simulating_pres_end{ state_pre_offsets_[simulating + 1] };
+            while (simulated_pre < simulated_pres_end && simulating_pre < simulating_pres_end) {
+                if (pre_symbols_[simulated_pre] < pre_symbols_[simulating_pre]) {
+                    ++simulated_pre;
+                } else if (pre_symbols_[simulating_pre] < pre_symbols_[simulated_pre]) {
+                    ++simulating_pre;
+                } else {
+                    const size_t rank{ pre_ranks_[simulated_pre] };
+                    for (size_t position{ pre_offsets_[simulating_pre] }; position < pre_offsets_[simulating_pre + 1];
+                         ++position) {
+                        const size_t post{ pre_source_posts_[position] };
+                        if (--counters[post_counter_offsets_[post] + rank] == 0) {
+                            remove_pres(simulated_pre, pre_sources_[position]);
+                        }
+                    }
+                    ++simulated_pre;
+                    ++simulating_pre;
+                }
+            }
+        }
+
+        Simlib::Util::BinaryRelation result(num_of_states_, false, std::max(num_of_states_, size_t{ 1 }));
+        for (State row{ 0 }; row < num_of_states_; ++row) {
+            for (State column{ 0 }; column < num_of_states_; ++column) {
+                if (relation.get(row, column)) { result.set(row, column, true); }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Initialize the relation: q may simulate p if q is distinguished whenever p is, and q has a transition over each
+     *  symbol p has a transition over. Rows are computed word by word from the sets of states with posts over symbols.
+     */
+    void initialize(BitMatrix& relation, const mata::utils::SparseSet<State>& distinguished) {
+        const size_t words_per_row{ relation.words_per_row() };
+        std::vector<BitMatrix::Word> all_states(words_per_row, ~BitMatrix::Word{ 0 });
+        if (num_of_states_ % BitMatrix::WORD_BITS != 0) {
+            all_states.back() = (BitMatrix::Word{ 1 } << (num_of_states_ % BitMatrix::WORD_BITS)) - 1;
+        }
+        const auto add_state = [](BitMatrix::Word* const states, const State state) {
+            states[state / BitMatrix::WORD_BITS] |= BitMatrix::Word{ 1 } << (state % BitMatrix::WORD_BITS);
+        };
+        std::vector<BitMatrix::Word> distinguished_states(words_per_row, 0);
+        for (const State state: distinguished) {
+            if (state < num_of_states_) { add_state(distinguished_states.data(), state); }
+        }
+        std::vector<BitMatrix::Word> symbol_states(num_of_symbols_ * words_per_row, 0);
+        for (State state{ 0 }; state < num_of_states_; ++state) {
+            for (size_t post{ state_post_offsets_[state] }; post < state_post_offsets_[state + 1]; ++post) {
+                add_state(symbol_states.data() + post_symbols_[post] * words_per_row, state);
+            }
+        }
+        for (State state{ 0 }; state < num_of_states_; ++state) {
+            BitMatrix::Word* const row{ relation.row(state) };
+            const std::vector<BitMatrix::Word>& allowed{
+                distinguished.contains(state) ? distinguished_states : all_states };
+            std::copy(allowed.begin(), allowed.end(), row);
+            for (size_t post{ state_post_offsets_[state] }; post < state_post_offsets_[state + 1]; ++post) {
+                const BitMatrix::Word* const states{ symbol_states.data() + post_symbols_[post] * words_per_row };
+                for (size_t word{ 0 }; word < words_per_row; ++word) { row[word] &= states[word]; }
+            }
+        }
+    }
+};
+
+} // namespace
+
+Simlib::Util::BinaryRelation mata::nfa::algorithms::compute_direct_simulation(
+    const Delta& delta, const size_t num_of_states, const utils::SparseSet<State>& distinguished, const bool backward) {
+    return SimulationEngine{ delta, num_of_states, backward }.compute(distinguished);
+}
+
+Simlib::Util::BinaryRelation mata::nfa::algorithms::compute_direct_simulation(
+    const FrozenDelta& delta, const size_t num_of_states, const utils::SparseSet<State>& distinguished,
+    const bool backward) {
+    return SimulationEngine{ delta, num_of_states, backward }.compute(distinguished);
+}
@@ -5,9 +5,15 @@
 #include "mata/nfa/nfa.hh"
 #include "mata/nfa/algorithms.hh"
 #include "mata/utils/sparse-set.hh"
+#include "mata/utils/adaptive-set.hh"
+#include "mata/utils/antichain.hh"
+
+#include <deque>
 
 using namespace mata::nfa;
 using namespace mata::utils;
+using mata::Symbol;
+using mata::Alphabet;
 
 //TODO: this could be merged with inclusion, or even removed, universality could be implemented using inclusion,
 // it is not something needed in practice, so some little overhead is ok
@@ -25,22 +31,49 @@ bool mata::nfa::algorithms::is_universal_naive(
 } // is_universal_naive }}}
 
 
-/// universality check using Antichains
-bool mata::nfa::algorithms::is_universal_antichains(
-	const Nfa&         aut,
-	const Alphabet&    alphabet,
-	Run*               cex)
+namespace {
+/// universality check using Antichains over macrostates of type @p Macrostate (either @c StateSet or @c AdaptiveSet)
+/// If the forward @p simulation over @p aut is given, macrostates are minimized by it and a macrostate is subsumed
+///  by another one whose states are all simulated by its states.
+template<class Macrostate>
+bool antichains_universality(
+	const Nfa&                          aut,
+	const Alphabet&                     alphabet,
+	Run*                                cex,
+	const Simlib::Util::BinaryRelation* simulation = nullptr)
 { // {{{
 
-	using WorklistType = std::list<StateSet>;
-	using ProcessedType = std::list<StateSet>;
+	// Is each state of 'lhs' simulated by some state of 'rhs'?
+	auto is_simulated = [&](const Macrostate& lhs, const Macrostate& rhs) {
+		return std::all_of(lhs.begin(), lhs.end(), [&](const State x) {
+			return std::any_of(rhs.begin(), rhs.end(), [&](const State y) { return simulation->get(x, y); });
+		});
+	};
 
-	auto subsumes = [](const StateSet& lhs, const StateSet& rhs) {
-		if (lhs.size() > rhs.size()) { // bigger set cannot be subset
-			return false;
+	// Remove states simulated by other states of the macrostate (keeping a single state of each class of
+	//  simulation-equivalent states). The language of the macrostate does not change.
+	auto minimize = [&](Macrostate& macrostate) {
+		if (simulation == nullptr || macrostate.size() < 2) { return; }
+		StateSet kept{};
+		for (const State x: macrostate) {
+			if (std::none_of(macrostate.begin(), macrostate.end(), [&](const State y) {
+				return x != y && simulation->get(x, y) && (!simulation->get(y, x) || y < x);
+			})) { kept.push_back(x); }
 		}
+		if (kept.size() != macrostate.size()) { macrostate = Macrostate{ kept }; }
+	};
 
-		return std::includes(rhs.begin(), rhs.end(), lhs.begin(), lhs.end());
+	// All successors of a macrostate are computed in a single pass synchronized over the symbol posts of its states.
+	SynchronizedExistentialSymbolPostIteratorOf<decltype(aut.delta)> sync_iterator;
+	[[maybe_unused]] typename AdaptiveSet<State>::Builder builder{ aut.num_of_states() };
+	auto unify_targets = [&]() {
+		if constexpr (std::is_same_v<Macrostate, StateSet>) {
+			return sync_iterator.unify_targets();
+		} else {
+			// Targets are collected in a bitset instead of merging the sorted target sets.
+			for (const auto& symbol_post: sync_iterator.get_current()) { builder.insert(symbol_post->targets); }
+			return builder.build();
+		}
 	};
 
 	// process parameters
@@ -53,83 +86,154 @@ bool mata::nfa::algorithms::is_universal_antichains(
 		return false;
 	}
 
+	// Macrostates discovered so far, identified by their index. 'parents[s] == {t, a}' denotes that macrostate 's' was
+	//  accessed from macrostate 't' over 'a', 'parents[s] == {s, 0}' means that 's' is the initial macrostate.
+	std::vector<std::pair<size_t, Symbol>> parents{};
+	// Macrostates removed from the antichain as subsumed are skipped when popped from the worklist.
+	std::vector<bool> is_alive{};
+	auto mark_erased = [&](const size_t macrostate) { is_alive[macrostate] = false; };
+	Antichain<Macrostate> processed{};
+	std::deque<std::pair<size_t, Macrostate>> worklist{};
+
+	auto insert = [&](Macrostate macrostate, const size_t parent, const Symbol symbol) {
+		const size_t index{ parents.size() };
+		parents.emplace_back(parent == Limits::max_state ? index : parent, symbol);
+		is_alive.push_back(true);
+		processed.insert(macrostate, index);
+		worklist.emplace_back(index, std::move(macrostate));
+	};
+
 	// initialize
-	WorklistType worklist = { StateSet(aut.initial) };
-	ProcessedType processed = { StateSet(aut.initial) };
+	Macrostate initial{ StateSet(aut.initial) };
+	minimize(initial);
+	insert(std::move(initial), Limits::max_state, 0);
 	mata::utils::OrdVector<Symbol> alph_symbols = alphabet.get_alphabet_symbols();
 
-	// 'paths[s] == t' denotes that state 's' was accessed from state 't',
-	// 'paths[s] == s' means that 's' is an initial state
-	std::map<StateSet, std::pair<StateSet, Symbol>> paths =
-		{ {StateSet(aut.initial), {StateSet(aut.initial), 0}} };
-
 	while (!worklist.empty()) {
 		// get a next state
-		StateSet state;
+		std::pair<size_t, Macrostate> state;
 		if (is_dfs) {
-			state = *worklist.rbegin();
+			state = std::move(worklist.back());
 			worklist.pop_back();
 		} else { // BFS
-			state = *worklist.begin();
+			state = std::move(worklist.front());
 			worklist.pop_front();
 		}
+		if (!is_alive[state.first]) { continue; }
 
-		// process it
-		for (Symbol symb : alph_symbols) {
-			StateSet succ = aut.post(state, symb);
-			if (!aut.final.intersects_with(succ)) {
-				if (nullptr != cex) {
-					cex->word.clear();
-					cex->word.push_back(symb);
-					StateSet trav = state;
-					while (paths[trav].first != trav)
-					{ // go back until initial state
-						cex->word.push_back(paths[trav].second);
-						trav = paths[trav].first;
-					}
-
-					std::reverse(cex->word.begin(), cex->word.end());
+		auto report_cex = [&](const Symbol symb) {
+			if (nullptr != cex) {
+				cex->word.clear();
+				cex->word.push_back(symb);
+				for (size_t trav{ state.first }; parents[trav].first != trav; trav = parents[trav].first)
+				{ // go back until initial state
+					cex->word.push_back(parents[trav].second);
 				}
 
+				std::reverse(cex->word.begin(), cex->word.end());
+			}
+		};
+
+		sync_iterator.reset();
+		for (const State q: state.second) { mata::utils::push_back(sync_iterator, aut.delta[q]); }
+
+		// process it: only the symbols used by some state of the macrostate are enumerated, alongside the symbols of the
+		//  alphabet. All the other symbols of the alphabet form a single class leading to the empty (rejecting)
+		//  macrostate, so the first of them met completes a counterexample.
+		auto symbols_it{ alph_symbols.begin() };
+		const auto symbols_end{ alph_symbols.end() };
+		while (symbols_it != symbols_end) {
+			if (!sync_iterator.advance()) {
+				report_cex(*symbols_it);
+				return false;
+			}
+			const Symbol symb{ (*sync_iterator.get_current().begin())->symbol };
+			if (symb < *symbols_it) { continue; } // not in the alphabet
+			if (*symbols_it < symb) {
+				report_cex(*symbols_it);
 				return false;
 			}
+			++symbols_it;
 
-			bool is_subsumed = false;
-			for (const auto& anti_state : processed) {
-				// trying to find a smaller state in processed
-				if (subsumes(anti_state, succ)) {
-					is_subsumed = true;
-					break;
-				}
+			Macrostate succ = unify_targets();
+			minimize(succ);
+			if (std::none_of(succ.begin(), succ.end(), [&](const State q) { return aut.final.contains(q); })) {
+				report_cex(symb);
+				return false;
 			}
 
-			if (is_subsumed) { continue; }
+			// trying to find a smaller state in processed
+			if (simulation == nullptr ? processed.contains_subset_of(succ)
+			                          : processed.any_of([&](const Macrostate& processed_state, size_t) {
+				                            return is_simulated(processed_state, succ);
+			                            })) {
+				continue;
+			}
 
 			// prune data structures and insert succ inside
-			for (std::list<StateSet>* ds : {&processed, &worklist}) {
-				auto it = ds->begin();
-				while (it != ds->end()) {
-					if (subsumes(succ, *it)) {
-						auto to_remove = it;
-						++it;
-						ds->erase(to_remove);
-					} else {
-						++it;
-					}
-				}
-
-				// TODO: set pushing strategy
-				ds->push_back(succ);
+			if (simulation == nullptr) {
+				processed.erase_supersets_of(succ, mark_erased);
+			} else {
+				processed.erase_if([&](const Macrostate& processed_state, size_t) {
+					return is_simulated(succ, processed_state);
+				}, mark_erased);
 			}
-
-			// also set that succ was accessed from state
-			paths[succ] = {state, symb};
+			// TODO: set pushing strategy
+			insert(std::move(succ), state.first, symb);
 		}
 	}
 
 	return true;
 } // }}}
 
+bool is_universal_antichains_adaptive(const Nfa& aut, const Alphabet& alphabet, Run* cex) {
+	return antichains_universality<AdaptiveSet<State>>(aut, alphabet, cex);
+}
+} // namespace
+
+bool mata::nfa::algorithms::is_universal_antichains_sim(
+	const Nfa&         aut,
+	const Alphabet&    alphabet,
+	Run*               cex)
+{ // {{{
+	const Simlib::Util::BinaryRelation simulation{
+		compute_direct_simulation(aut.delta, aut.num_of_states(), aut.final) };
+	return antichains_universality<StateSet>(aut, alphabet, cex, &simulation);
+} // }}}
+
+namespace {
+/// The automaton accepting all words over @p alphabet: universality is inclusion of its language.
+Nfa create_universal(const Alphabet& alphabet) {
+	Nfa universal{ 1, { 0 }, { 0 } };
+	for (const Symbol symbol: alphabet.get_alphabet_symbols()) { universal.delta.add(0, symbol, 0); }
+	return universal;
+}
+} // namespace
+
+bool mata::nfa::algorithms::is_universal_hkc(
+	const Nfa&         aut,
+	const Alphabet&    alphabet,
+	Run*               cex)
+{ // {{{
+	return is_included_hkc(create_universal(alphabet), aut, &alphabet, cex);
+} // }}}
+
+bool mata::nfa::algorithms::is_universal_hkc_sim(
+	const Nfa&         aut,
+	const Alphabet&    alphabet,
+	Run*               cex)
+{ // {{{
+	return is_included_hkc_sim(create_universal(alphabet), aut, &alphabet, cex);
+} // }}}
+
+bool mata::nfa::algorithms::is_universal_antichains(
+	const Nfa&         aut,
+	const Alphabet&    alphabet,
+	Run*               cex)
+{ // {{{
+	return antichains_universality<StateSet>(aut, alphabet, cex);
+} // }}}
+
 // The dispatching method that calls the correct one based on parameters.
 bool mata::nfa::Nfa::is_universal(const Alphabet& alphabet, Run* cex, const ParameterMap& params) const {
 	// setting the default algorithm
@@ -143,7 +247,14 @@ bool mata::nfa::Nfa::is_universal(const Alphabet& alphabet, Run* cex, const Para
 	const std::string& str_algo = params.at("algorithm");
 	if ("naive" == str_algo) { /* default */ }
 	else if ("antichains" == str_algo) {
-		algo = algorithms::is_universal_antichains;
+		algo = algorithms::use_adaptive_macrostates(params) ? is_universal_antichains_adaptive
+		                                                    : algorithms::is_universal_antichains;
+	} else if ("antichains-sim" == str_algo) {
+		algo = algorithms::is_universal_antichains_sim;
+	} else if ("hkc" == str_algo) {
+		algo = algorithms::is_universal_hkc;
+	} else if ("hkc-sim" == str_algo) {
+		algo = algorithms::is_universal_hkc_sim;
 	} else {
 		throw std::runtime_error(std::to_string(__func__) +
 			" received an unknown value of the \"algorithm\" key: " + str_algo);
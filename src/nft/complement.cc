@@ -20,7 +20,7 @@ Nft mata::nft::algorithms::complement_classical(const Nft& aut, const OrdVector<
             // which can be the sink state (so we do not create unnecessary one)
             sink_state = *result.initial.begin();
         } else {
-            sink_state = result.num_of_states();
+            sink_state = static_cast<State>(result.num_of_states());
         }
     } else {
         std::unordered_map<StateSet, State> subset_map;
@@ -30,12 +30,12 @@ Nft mata::nft::algorithms::complement_classical(const Nft& aut, const OrdVector<
         if (sink_state_iter != subset_map.end()) {
             sink_state = sink_state_iter->second;
         } else {
-            sink_state = result.num_of_states();
+            sink_state = static_cast<State>(result.num_of_states());
         }
     }
 
     result.make_complete(symbols, sink_state);
-    result.final.complement(result.num_of_states());
+    result.final.complement(static_cast<State>(result.num_of_states()));
     return result;
 }
 
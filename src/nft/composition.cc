@@ -86,8 +86,8 @@ Nft compose(const Nft& lhs, const Nft& rhs, const OrdVector<Level>& lhs_sync_lev
     Nft rhs_synced = insert_levels(rhs, rhs_new_levels_mask, jump_mode);
 
     // Two auxiliary states (states from inserted loops) can not create a product state.
-    const State lhs_first_aux_state = lhs_synced.num_of_states();
-    const State rhs_first_aux_state = rhs_synced.num_of_states();
+    const State lhs_first_aux_state = static_cast<State>(lhs_synced.num_of_states());
+    const State rhs_first_aux_state = static_cast<State>(rhs_synced.num_of_states());
 
     insert_self_loops(lhs_synced, lhs_new_levels_mask);
     insert_self_loops(rhs_synced, rhs_new_levels_mask);
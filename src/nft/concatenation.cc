@@ -18,7 +18,7 @@ Nft& Nft::concatenate(const Nft& aut) {
     assert(num_of_levels == aut.num_of_levels);
     size_t n = this->num_of_states();
     auto upd_fnc = [&](State st) {
-        return st + n;
+        return static_cast<State>(st + n);
     };
 
     // copy the information about aut to save the case when this is the same object as aut.
@@ -96,7 +96,7 @@ Nft algorithms::concatenate_eps(const Nft& lhs, const Nft& rhs, const Symbol& ep
     result = Nft::with_levels(lhs.num_of_levels);
     result.delta = lhs.delta;
     result.initial = lhs.initial;
-    result.add_state(result_num_of_states-1);
+    result.add_state(static_cast<State>(result_num_of_states - 1));
 
     // Add epsilon transitions connecting lhs and rhs automata.
     // The epsilon transitions lead from lhs original final states to rhs original initial states.
@@ -209,7 +209,7 @@ Nft mata::nft::algorithms::product(const Nft& lhs, const Nft& rhs, const std::fu
 
         if (sources_are_on_the_same_level || jump_mode == JumpMode::RepeatSymbol) {
             // Compute classic product for current state pair.
-            mata::utils::SynchronizedUniversalIterator<mata::utils::OrdVector<SymbolPost>::const_iterator> sync_iterator(2);
+            mata::utils::SynchronizedUniversalIterator<StatePost::const_iterator> sync_iterator(2);
             mata::utils::push_back(sync_iterator, lhs.delta[lhs_source]);
             mata::utils::push_back(sync_iterator, rhs.delta[rhs_source]);
             while (sync_iterator.advance()) {
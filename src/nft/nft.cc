@@ -176,10 +176,10 @@ void Nft::print_to_mata(std::ostream &output) const {
         for (const State &s : final) {
             live_states[s] = true;
         }
-        for (const Transition &trans: delta.transitions()) {
-            live_states[trans.source] = true;
-            live_states[trans.target] = true;
-        }
+        delta.for_each_transition([&](const State source, Symbol, const State target) {
+            live_states[source] = true;
+            live_states[target] = true;
+        });
         output << "%Levels";
         for (State s{ 0 }; s < num_of_states(); s++) {
             if (live_states[s]) {
@@ -190,9 +190,9 @@ void Nft::print_to_mata(std::ostream &output) const {
     }
     output << "%LevelsNum " << num_of_levels << std::endl;
 
-    for (const Transition& trans: delta.transitions()) {
-        output << "q" << trans.source << " " << trans.symbol << " q" << trans.target << std::endl;
-    }
+    delta.for_each_transition([&](const State source, const Symbol symbol, const State target) {
+        output << "q" << source << " " << symbol << " q" << target << std::endl;
+    });
 }
 
 Nft Nft::get_one_letter_aut(Symbol abstract_symbol) const {
@@ -318,7 +318,7 @@ State Nft::insert_word(const State source, const Word &word, const State target)
         throw std::invalid_argument{ "Inserting word between source and target states with different levels." };
     }
 
-    const State first_new_state = num_of_states();
+    const State first_new_state = static_cast<State>(num_of_states());
     const State word_target = Nfa::insert_word(source, word, target);
     const size_t num_of_states_after = num_of_states();
     const Level source_level = levels[source];
@@ -11,10 +11,10 @@
 #include "mata/nft/delta.hh"
 #include "mata/utils/sparse-set.hh"
 #include "mata/nft/nft.hh"
+#include "mata/nfa/algorithms.hh"
 #include "mata/nft/algorithms.hh"
 #include "mata/nft/builder.hh"
 #include "mata/nft/strings.hh"
-#include <mata/simlib/explicit_lts.hh>
 
 using std::tie;
 
@@ -27,27 +27,9 @@ using mata::Symbol;
 using StateBoolArray = std::vector<bool>; ///< Bool array for states in the automaton.
 
 namespace {
-    Simlib::Util::BinaryRelation compute_fw_direct_simulation(const Nft& aut) {
-        Symbol maxSymbol{ aut.delta.get_max_symbol() };
-        const size_t state_num{ aut.num_of_states() };
-        Simlib::ExplicitLTS LTSforSimulation(state_num);
-
-        for (const Transition& transition : aut.delta.transitions()) {
-            LTSforSimulation.add_transition(transition.source, transition.symbol, transition.target);
-        }
-
-        // final states cannot be simulated by nonfinal -> we add new selfloops over final states with new symbol in LTS
-        for (State finalState : aut.final) {
-            LTSforSimulation.add_transition(finalState, maxSymbol + 1, finalState);
-        }
-
-        LTSforSimulation.init();
-        return LTSforSimulation.compute_simulation();
-    }
-
     Nft reduce_size_by_simulation(const Nft& aut, StateRenaming &state_renaming) {
         Nft result;
-        const auto sim_relation = algorithms::compute_relation(
+        const auto sim_relation = nft::algorithms::compute_relation(
                 aut, ParameterMap{{ "relation", "simulation"}, { "direction", "forward"}});
 
         auto sim_relation_symmetric = sim_relation;
@@ -61,7 +43,7 @@ namespace {
 
         // map each state q of aut to the state of the reduced automaton representing the simulation class of q
         for (State q = 0; q < num_of_states; ++q) {
-            const State qReprState = quot_proj[q];
+            const State qReprState = static_cast<State>(quot_proj[q]);
             if (state_renaming.count(qReprState) == 0) { // we need to map q's class to a new state in reducedAut
                 const State qClass = result.add_state();
                 state_renaming[qReprState] = qClass;
@@ -83,7 +65,7 @@ namespace {
                     const StateSet representatives_of_states_to = [&]{
                         StateSet state_set;
                         for (auto s : q_trans.targets) {
-                            state_set.insert(quot_proj[s]);
+                            state_set.insert(static_cast<State>(quot_proj[s]));
                         }
                         return state_set;
                     }();
@@ -118,65 +100,9 @@ namespace {
     }
 }
 
-//TODO: based on the comments inside, this function needs to be rewritten in a more optimal way.
 Nft mata::nft::remove_epsilon(const Nft& aut, Symbol epsilon) {
-    // cannot use multimap, because it can contain multiple occurrences of (a -> a), (a -> a)
-    std::unordered_map<State, StateSet> eps_closure;
-
-    // TODO: grossly inefficient
-    // first we compute the epsilon closure
-    const size_t num_of_states{aut.num_of_states() };
-    for (size_t i{ 0 }; i < num_of_states; ++i)
-    {
-        for (const auto& trans: aut.delta[i])
-        { // initialize
-            const auto it_ins_pair = eps_closure.insert({i, {i}});
-            if (trans.symbol == epsilon)
-            {
-                StateSet& closure = it_ins_pair.first->second;
-                // TODO: Fix possibly insert to OrdVector. Create list already ordered, then merge (do not need to resize each time);
-                closure.insert(trans.targets);
-            }
-        }
-    }
-
-    bool changed = true;
-    while (changed) { // Compute the fixpoint.
-        changed = false;
-        for (size_t i = 0; i < num_of_states; ++i) {
-            const StatePost& post{ aut.delta[i] };
-            const auto eps_move_it { post.find(epsilon) };//TODO: make faster if default epsilon
-            if (eps_move_it != post.end()) {
-                StateSet& src_eps_cl = eps_closure[i];
-                for (const State tgt: eps_move_it->targets) {
-                    const StateSet& tgt_eps_cl = eps_closure[tgt];
-                    for (const State st: tgt_eps_cl) {
-                        if (src_eps_cl.count(st) == 0) {
-                            changed = true;
-                            break;
-                        }
-                    }
-                    src_eps_cl.insert(tgt_eps_cl);
-                }
-            }
-        }
-    }
-
-    // Construct the automaton without epsilon transitions.
     Nft result{ Delta{}, aut.initial, aut.final, aut.levels, aut.num_of_levels, aut.alphabet };
-    for (const auto& state_closure_pair : eps_closure) { // For every state.
-        State src_state = state_closure_pair.first;
-        for (State eps_cl_state : state_closure_pair.second) { // For every state in its epsilon closure.
-            if (aut.final[eps_cl_state]) result.final.insert(src_state);
-            for (const SymbolPost& move : aut.delta[eps_cl_state]) {
-                if (move.symbol == epsilon) continue;
-                // TODO: this could be done more efficiently if we had a better add method
-                for (State tgt_state : move.targets) {
-                    result.delta.add(src_state, move.symbol, tgt_state);
-                }
-            }
-        }
-    }
+    result.delta = nfa::algorithms::remove_epsilon_transitions(aut.delta, epsilon, result.final);
     return result;
 }
 
@@ -662,7 +588,7 @@ Nft mata::nft::somewhat_simple_revert(const Nft& aut) {
     }
 
     //sorting the targets
-    for (State q = 0, states_num = result.delta.num_of_states(); q < states_num; ++q) {
+    for (State q = 0, states_num = static_cast<State>(result.delta.num_of_states()); q < states_num; ++q) {
         //Post & post = result.delta.get_mutable_post(q);
         //utils::sort_and_rmdupl(post);
         for (SymbolPost& m: result.delta.mutable_state_post(q)) { sort_and_rmdupl(m.targets); }
@@ -761,7 +687,7 @@ Nft mata::nft::uni(const Nft &lhs, const Nft &rhs) {
 Nft& Nft::uni(const Nft& aut) {
     size_t n = this->num_of_states();
     auto upd_fnc = [&](State st) {
-        return st + n;
+        return static_cast<State>(st + n);
     };
 
     // copy the information about aut to save the case when this is the same object as aut.
@@ -801,7 +727,7 @@ Simlib::Util::BinaryRelation mata::nft::algorithms::compute_relation(const Nft&
     const std::string& relation = params.at("relation");
     const std::string& direction = params.at("direction");
     if ("simulation" == relation && direction == "forward") {
-        return compute_fw_direct_simulation(aut);
+        return nfa::algorithms::compute_direct_simulation(aut.delta, aut.num_of_states(), aut.final);
     }
     else {
         throw std::runtime_error(std::to_string(__func__) +
@@ -862,7 +788,7 @@ Nft mata::nft::determinize(
     if (aut.delta.empty())
         return result;
 
-    using Iterator = mata::utils::OrdVector<SymbolPost>::const_iterator;
+    using Iterator = StatePost::const_iterator;
     SynchronizedExistentialSymbolPostIterator synchronized_iterator;
 
     while (!worklist.empty()) {
@@ -123,7 +123,7 @@ namespace {
                         if (is_subsequence(subsubword, literal)) {
                             // it...end is a valid literal subvector. Transition should therefore lead to the corresponding
                             //  subvector init_state.
-                            target_state = subsubword.size();
+                            target_state = static_cast<State>(subsubword.size());
                             break;
                         }
                         ++subword_next_symbol_it;
@@ -411,7 +411,7 @@ Nft ReluctantReplace::reluctant_leftmost_nft(nfa::Nfa nfa, Alphabet* alphabet, S
     nft_reluctant_leftmost.insert_identity(initial, alphabet_symbols.to_vector());
 
     // Move to replace mode when begin marker is encountered.
-    State curr_state{ nft_reluctant_leftmost.num_of_states() };
+    State curr_state{ static_cast<State>(nft_reluctant_leftmost.num_of_states()) };
     nft_reluctant_leftmost.delta.add(initial, begin_marker, curr_state);
     nft_reluctant_leftmost.delta.mutable_state_post(curr_state).push_back(
         SymbolPost{ EPSILON, StateSet{ nft_reluctant_leftmost.initial } }
@@ -137,7 +137,7 @@ namespace {
             this->outgoingEdges = std::vector<std::vector<std::pair<mata::Symbol, mata::nfa::State>>> (prog_size);
 
             // We traverse all the states and create corresponding states and edges in Nfa
-            for (State current_state = start_state, re2_state = start_state; re2_state < prog_size; ++
+            for (State current_state = static_cast<State>(start_state), re2_state = current_state; re2_state < prog_size; ++
                  re2_state) {
                 /// Whether to increment the current state @c current_state when the @c re2_state increments.
                 bool increment_current_state{true};
@@ -349,7 +349,7 @@ namespace {
             mata::nfa::State mapped_parget_state;
             std::vector<mata::nfa::State> states_for_second_check(prog_size);
 
-            for (mata::nfa::State state = start_state; state < prog_size; state++) {
+            for (mata::nfa::State state = static_cast<mata::nfa::State>(start_state); state < prog_size; state++) {
                 re2::Prog::Inst *inst = prog->inst(static_cast<int>(state));
                 if (inst->last()) {
                     this->state_cache.is_last[state] = true;
@@ -47,7 +47,7 @@ std::vector<seg_nfa::Noodle> seg_nfa::noodlify(const SegNfa& aut, const Symbol e
         }
     }
 
-    State unused_state = aut.num_of_states(); // get some State not used in aut
+    State unused_state = static_cast<State>(aut.num_of_states()); // get some State not used in aut
     std::map<std::pair<State, State>, std::shared_ptr<Nfa>> segments_one_initial_final;
     segs_one_initial_final(segments, include_empty, unused_state, segments_one_initial_final);
 
@@ -175,7 +175,7 @@ std::vector<seg_nfa::NoodleWithEpsilonsCounter> seg_nfa::noodlify_mult_eps(const
         }
     }
 
-    State unused_state = aut.num_of_states(); // get some State not used in aut
+    State unused_state = static_cast<State>(aut.num_of_states()); // get some State not used in aut
     std::map<std::pair<State, State>, std::shared_ptr<Nfa>> segments_one_initial_final;
     segs_one_initial_final(segments, include_empty, unused_state, segments_one_initial_final);
 
@@ -0,0 +1,82 @@
+/**
+ * Benchmark: Subset constructions over sorted-vector and adaptive macrostates.
+ *
+ * The benchmark program compares determinization, antichain inclusion and antichain universality with macrostates
+ *  represented by sorted vectors (@c StateSet) and by @c AdaptiveSet, which switches between a sorted vector and
+ *  a bitset by the density of the macrostate. Determinization is measured also on a random automaton generated by the
+ *  Tabakov-Vardi model, whose macrostates are dense.
+ *
+ * Optimal Inputs: inputs/bench-double-automata-inclusion.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+#include "mata/nfa/builder.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+/// Parameters of the random automaton.
+constexpr size_t RANDOM_NUM_OF_STATES{ 1000 };
+constexpr size_t RANDOM_ALPHABET_SIZE{ 2 };
+constexpr double RANDOM_TRANSITION_DENSITY{ 4.0 };
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames {argv[1], argv[2]};
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const Nfa& lhs = automata[0];
+    const Nfa& rhs = automata[1];
+    const ParameterMap sorted_vector{ { "algorithm", "antichains" }, { "macrostate", "sorted-vector" } };
+    const ParameterMap adaptive{ { "algorithm", "antichains" }, { "macrostate", "adaptive" } };
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(determinize);
+    determinize(lhs, nullptr, std::nullopt, sorted_vector);
+    TIME_END(determinize);
+
+    TIME_BEGIN(determinize_adaptive);
+    determinize(lhs, nullptr, std::nullopt, adaptive);
+    TIME_END(determinize_adaptive);
+
+    TIME_BEGIN(inclusion_antichains);
+    is_included(lhs, rhs, &alphabet, sorted_vector);
+    TIME_END(inclusion_antichains);
+
+    TIME_BEGIN(inclusion_antichains_adaptive);
+    is_included(lhs, rhs, &alphabet, adaptive);
+    TIME_END(inclusion_antichains_adaptive);
+
+    TIME_BEGIN(universality_antichains);
+    rhs.is_universal(alphabet, sorted_vector);
+    TIME_END(universality_antichains);
+
+    TIME_BEGIN(universality_antichains_adaptive);
+    rhs.is_universal(alphabet, adaptive);
+    TIME_END(universality_antichains_adaptive);
+
+    const Nfa random_nfa{ mata::nfa::builder::create_random_nfa_tabakov_vardi(
+        RANDOM_NUM_OF_STATES, RANDOM_ALPHABET_SIZE, RANDOM_TRANSITION_DENSITY, 0.5) };
+
+    TIME_BEGIN(random_determinize);
+    const Nfa random_dfa{ determinize(random_nfa, nullptr, std::nullopt, sorted_vector) };
+    TIME_END(random_determinize);
+    std::cout << "random_dfa_states: " << random_dfa.num_of_states() << "\n";
+
+    TIME_BEGIN(random_determinize_adaptive);
+    determinize(random_nfa, nullptr, std::nullopt, adaptive);
+    TIME_END(random_determinize_adaptive);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/**
+ * Benchmark: Heap allocations and peak memory of automata operations.
+ *
+ * The benchmark program counts heap allocations (calls of the global `operator new`) and allocated bytes of copying
+ *  the input automata, of intersection, antichain inclusion, determinization and simulation-based reduction, and of a
+ *  pipeline of boolean operations on temporary automata. Peak resident set size of the whole run is reported at the
+ *  end. Compare the counts of builds with and without the CMake option `MATA_POOL_ALLOCATOR`.
+ *
+ * Optimal Inputs: inputs/bench-double-automata-inclusion.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+#include <cstdlib>
+#include <new>
+#include <sys/resource.h>
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+/// Number of iterations of the pipeline of boolean operations.
+constexpr size_t PIPELINE_ITERATIONS{ 10 };
+
+namespace {
+size_t num_of_allocations{ 0 }; ///< Number of calls of the global `operator new`.
+size_t num_of_allocated_bytes{ 0 }; ///< Number of bytes requested from the global `operator new`.
+} // namespace.
+
+void* operator new(const size_t size) {
+    ++num_of_allocations;
+    num_of_allocated_bytes += size;
+    if (void* ptr{ std::malloc(size) }) { return ptr; }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+/*
+ * Use to start counting heap allocations with user-defined prefix `counter`.
+ */
+#define ALLOCATIONS_BEGIN(counter) \
+    const size_t counter##_allocations_start{ num_of_allocations }; \
+    const size_t counter##_bytes_start{ num_of_allocated_bytes }
+
+/*
+ * Use to print the number of heap allocations and allocated bytes since `ALLOCATIONS_BEGIN(counter)`.
+ */
+#define ALLOCATIONS_END(counter) do { \
+        std::cout << #counter "_allocations: " << num_of_allocations - counter##_allocations_start << "\n"; \
+        std::cout << #counter "_allocated_bytes: " << num_of_allocated_bytes - counter##_bytes_start << "\n"; \
+    } while(0)
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames {argv[1], argv[2]};
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    // Copying the loaded automata allocates exactly the transition relations (and the sets of initial/final states).
+    ALLOCATIONS_BEGIN(copy);
+    const Nfa lhs{ automata[0] };
+    const Nfa rhs{ automata[1] };
+    ALLOCATIONS_END(copy);
+    std::cout << "transitions: " << lhs.delta.num_of_transitions() + rhs.delta.num_of_transitions() << "\n";
+
+    ALLOCATIONS_BEGIN(intersection);
+    TIME_BEGIN(intersection);
+    const Nfa product{ intersection(lhs, rhs) };
+    TIME_END(intersection);
+    ALLOCATIONS_END(intersection);
+
+    ALLOCATIONS_BEGIN(inclusion_antichains);
+    TIME_BEGIN(inclusion_antichains);
+    mata::nfa::algorithms::is_included_antichains(lhs, rhs);
+    TIME_END(inclusion_antichains);
+    ALLOCATIONS_END(inclusion_antichains);
+
+    ALLOCATIONS_BEGIN(determinize);
+    TIME_BEGIN(determinize);
+    const Nfa determinized{ determinize(lhs) };
+    TIME_END(determinize);
+    ALLOCATIONS_END(determinize);
+
+    ALLOCATIONS_BEGIN(reduce);
+    TIME_BEGIN(reduce);
+    const Nfa reduced{ reduce(lhs) };
+    TIME_END(reduce);
+    ALLOCATIONS_END(reduce);
+
+    // A pipeline of boolean operations creating and destroying temporary automata.
+    ALLOCATIONS_BEGIN(pipeline);
+    TIME_BEGIN(pipeline);
+    for (size_t iteration{ 0 }; iteration < PIPELINE_ITERATIONS; ++iteration) {
+        Nfa temporary{ union_nondet(lhs, rhs) };
+        temporary = revert(temporary);
+        temporary = intersection(temporary, revert(rhs));
+        temporary.trim();
+    }
+    TIME_END(pipeline);
+    ALLOCATIONS_END(pipeline);
+
+    // Chunks of the pool are allocated by the global `operator new`, hence they are included in the counts above.
+    const mata::utils::pool::Statistics pool_statistics{ mata::utils::pool::statistics() };
+    std::cout << "pool_chunks: " << pool_statistics.num_of_chunks << "\n";
+    std::cout << "pool_reserved_bytes: " << pool_statistics.num_of_reserved_bytes << "\n";
+
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << "max_rss_kb: " << usage.ru_maxrss << "\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/**
+ * Benchmark: Memory and time footprint of the state representation.
+ *
+ * Build the benchmark twice, once with the default configuration and once with `-DMATA_COMPACT_STATES=ON`, and compare
+ *  the reported numbers to see the effect of 32-bit states on the transition relation and on the hot loops of inclusion,
+ *  intersection and determinization.
+ *
+ * Optimal Inputs: inputs/bench-double-automata-inclusion.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+namespace {
+/**
+ * Estimate the number of heap bytes occupied by the transition relation @p delta (allocated capacities included).
+ */
+size_t delta_heap_bytes(const Delta& delta) {
+    size_t bytes{ delta.num_of_states() * sizeof(StatePost) };
+    for (const StatePost& state_post: delta) {
+        bytes += state_post.to_vector().capacity() * sizeof(SymbolPost);
+        for (const SymbolPost& symbol_post: state_post) {
+            // Targets stored inline in the symbol post are already counted in sizeof(SymbolPost).
+            if (!symbol_post.targets.to_vector().is_inline()) {
+                bytes += symbol_post.targets.to_vector().capacity() * sizeof(State);
+            }
+        }
+    }
+    return bytes;
+}
+} // namespace.
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames {argv[1], argv[2]};
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const Nfa& lhs = automata[0];
+    const Nfa& rhs = automata[1];
+
+    std::cout << "state_bytes: " << sizeof(State) << "\n";
+    std::cout << "symbol_post_bytes: " << sizeof(SymbolPost) << "\n";
+    std::cout << "transitions: " << lhs.delta.num_of_transitions() + rhs.delta.num_of_transitions() << "\n";
+    std::cout << "delta_heap_bytes: " << delta_heap_bytes(lhs.delta) + delta_heap_bytes(rhs.delta) << "\n";
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    Nfa product;
+    TIME_BEGIN(intersection);
+    product = intersection(lhs, rhs);
+    TIME_END(intersection);
+    std::cout << "intersection_delta_heap_bytes: " << delta_heap_bytes(product.delta) << "\n";
+
+    TIME_BEGIN(inclusion_antichains);
+    mata::nfa::is_included(lhs, rhs, &alphabet, {{ "algorithm", "antichains" }});
+    TIME_END(inclusion_antichains);
+
+    Nfa determinized;
+    TIME_BEGIN(determinize);
+    determinized = determinize(lhs);
+    TIME_END(determinize);
+    std::cout << "determinize_delta_heap_bytes: " << delta_heap_bytes(determinized.delta) << "\n";
+
+    return EXIT_SUCCESS;
+}
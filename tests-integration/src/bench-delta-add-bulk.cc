@@ -0,0 +1,82 @@
+/**
+ * Benchmark: Construction of the transition relation by adding single transitions and in bulk.
+ *
+ * The benchmark program takes the transitions of the input automaton, shuffles them, and builds a new @c Delta by
+ *  calling @c Delta::add() for each transition and by a single @c Delta::add_bulk(). The same is measured on a random
+ *  automaton generated by the Tabakov-Vardi model with a high number of transitions per state.
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+#include "mata/nfa/builder.hh"
+
+#include <random>
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+/// Parameters of the random automaton.
+constexpr size_t RANDOM_NUM_OF_STATES{ 1000 };
+constexpr size_t RANDOM_ALPHABET_SIZE{ 2 };
+constexpr double RANDOM_TRANSITION_DENSITY{ 500.0 };
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    std::vector<Transition> transitions{ aut.delta.transitions().begin(), aut.delta.transitions().end() };
+    std::shuffle(transitions.begin(), transitions.end(), std::mt19937{ 0 });
+    std::cout << "transitions: " << transitions.size() << "\n";
+
+    TIME_BEGIN(add);
+    Delta delta_add{};
+    for (const Transition& transition: transitions) { delta_add.add(transition); }
+    TIME_END(add);
+
+    TIME_BEGIN(add_bulk);
+    Delta delta_add_bulk{};
+    delta_add_bulk.add_bulk(std::vector<Transition>{ transitions });
+    TIME_END(add_bulk);
+
+    if (delta_add != delta_add_bulk) {
+        std::cerr << "Delta::add() and Delta::add_bulk() differ\n";
+        return EXIT_FAILURE;
+    }
+
+    TIME_BEGIN(random_tabakov_vardi);
+    const Nfa random_nfa{ mata::nfa::builder::create_random_nfa_tabakov_vardi(
+        RANDOM_NUM_OF_STATES, RANDOM_ALPHABET_SIZE, RANDOM_TRANSITION_DENSITY, 0.5) };
+    TIME_END(random_tabakov_vardi);
+    std::cout << "random_transitions: " << random_nfa.delta.num_of_transitions() << "\n";
+
+    std::vector<Transition> random_transitions{ random_nfa.delta.transitions().begin(),
+                                                random_nfa.delta.transitions().end() };
+    std::shuffle(random_transitions.begin(), random_transitions.end(), std::mt19937{ 0 });
+
+    TIME_BEGIN(random_add);
+    Delta random_delta_add{};
+    for (const Transition& transition: random_transitions) { random_delta_add.add(transition); }
+    TIME_END(random_add);
+
+    TIME_BEGIN(random_add_bulk);
+    Delta random_delta_add_bulk{};
+    random_delta_add_bulk.add_bulk(std::move(random_transitions));
+    TIME_END(random_add_bulk);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,58 @@
+/**
+ * Benchmark: Determinization of automata with epsilon transitions.
+ *
+ * The benchmark program adds epsilon transitions to the input automaton (from every fourth state) and determinizes
+ *  it, first by removing the epsilon transitions with @c remove_epsilon() and then by closing macrostates under epsilon
+ *  transitions on the fly (the "first_epsilon" parameter of @c determinize()). It checks that both results accept the
+ *  same language.
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+/// Every EPSILON_STEP-th state gets an epsilon transition.
+constexpr size_t EPSILON_STEP{ 4 };
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const size_t num_of_states{ aut.num_of_states() };
+    for (State source{ 0 }; source < num_of_states; source += EPSILON_STEP) {
+        aut.delta.add(source, mata::nfa::EPSILON, (source * 7 + 1) % num_of_states);
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(remove_epsilon_determinize);
+    const Nfa expected{ determinize(remove_epsilon(aut)) };
+    TIME_END(remove_epsilon_determinize);
+    std::cout << "macrostates: " << expected.num_of_states() << "\n";
+
+    TIME_BEGIN(on_the_fly_epsilon_determinize);
+    const Nfa result{
+        determinize(aut, nullptr, std::nullopt, { { "first_epsilon", std::to_string(mata::nfa::EPSILON) } }) };
+    TIME_END(on_the_fly_epsilon_determinize);
+    std::cout << "macrostates: " << result.num_of_states() << "\n";
+
+    if (!are_equivalent(result, expected)) {
+        std::cerr << "Determinization with epsilon closures differs\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+/**
+ * Benchmark: Read-only algorithms on frozen automata.
+ *
+ * The benchmark program compares intersection, antichain inclusion, determinization, computation of useful states and
+ *  membership queries on @c Nfa against the same algorithms on its @c FrozenNfa snapshot. The time needed to create
+ *  the snapshot is reported separately.
+ *
+ * Optimal Inputs: inputs/bench-double-automata-inclusion.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+#include "mata/nfa/algorithms.hh"
+
+#include <random>
+
+using mata::Word;
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+/// Number of membership queries of words generated by random walks in the first automaton.
+constexpr size_t NUM_OF_MEMBERSHIP_QUERIES{ 10000 };
+constexpr size_t MAX_MEMBERSHIP_QUERY_LENGTH{ 64 };
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames {argv[1], argv[2]};
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const Nfa& lhs = automata[0];
+    const Nfa& rhs = automata[1];
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(freeze);
+    const FrozenNfa frozen_lhs{ lhs };
+    const FrozenNfa frozen_rhs{ rhs };
+    TIME_END(freeze);
+
+    auto both_final = [&](const State lhs_state, const State rhs_state) {
+        return lhs.final.contains(lhs_state) && rhs.final.contains(rhs_state);
+    };
+
+    TIME_BEGIN(intersection);
+    mata::nfa::algorithms::product(lhs, rhs, both_final);
+    TIME_END(intersection);
+
+    TIME_BEGIN(intersection_frozen);
+    mata::nfa::algorithms::product(frozen_lhs, frozen_rhs, both_final);
+    TIME_END(intersection_frozen);
+
+    TIME_BEGIN(inclusion_antichains);
+    mata::nfa::algorithms::is_included_antichains(lhs, rhs);
+    TIME_END(inclusion_antichains);
+
+    TIME_BEGIN(inclusion_antichains_frozen);
+    mata::nfa::algorithms::is_included_antichains(frozen_lhs, frozen_rhs);
+    TIME_END(inclusion_antichains_frozen);
+
+    TIME_BEGIN(determinize);
+    determinize(lhs);
+    TIME_END(determinize);
+
+    TIME_BEGIN(determinize_frozen);
+    determinize(frozen_lhs);
+    TIME_END(determinize_frozen);
+
+    TIME_BEGIN(useful_states);
+    lhs.get_useful_states();
+    rhs.get_useful_states();
+    TIME_END(useful_states);
+
+    TIME_BEGIN(useful_states_frozen);
+    frozen_lhs.get_useful_states();
+    frozen_rhs.get_useful_states();
+    TIME_END(useful_states_frozen);
+
+    // Generate the queried words by random walks in lhs.
+    std::mt19937 generator{ 0 };
+    std::vector<Word> queries(lhs.initial.empty() ? 0 : NUM_OF_MEMBERSHIP_QUERIES);
+    for (Word& word: queries) {
+        State state{ *std::next(lhs.initial.begin(), static_cast<long>(generator() % lhs.initial.size())) };
+        while (word.size() < MAX_MEMBERSHIP_QUERY_LENGTH && !lhs.delta[state].empty()) {
+            const StatePost& state_post{ lhs.delta[state] };
+            const SymbolPost& symbol_post{ *std::next(state_post.begin(), static_cast<long>(generator() % state_post.size())) };
+            word.push_back(symbol_post.symbol);
+            state = *std::next(symbol_post.targets.begin(), static_cast<long>(generator() % symbol_post.targets.size()));
+        }
+    }
+
+    TIME_BEGIN(is_in_lang);
+    for (const Word& word: queries) { rhs.is_in_lang(Run{ word, {} }); }
+    TIME_END(is_in_lang);
+
+    TIME_BEGIN(is_in_lang_frozen);
+    for (const Word& word: queries) { frozen_rhs.is_in_lang(word); }
+    TIME_END(is_in_lang_frozen);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/**
+ * Benchmark: Inclusion and equivalence by antichains and by bisimulation up to congruence (HKC).
+ *
+ * The benchmark program checks inclusion of the first input automaton in the second one and equivalence of both
+ *  automata by antichains, by HKC, and by HKC up to similarity, and checks that the results agree. Equivalence of the first automaton with its
+ *  reduction (a near-identical automaton) is checked as well.
+ *
+ * Optimal Inputs: inputs/bench-double-automata-inclusion.in
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames {argv[1], argv[2]};
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const Nfa& lhs = automata[0];
+    const Nfa& rhs = automata[1];
+    const Nfa reduced{ reduce(lhs) };
+
+    const ParameterMap antichains{ { "algorithm", "antichains" } };
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    bool expected_included, expected_equivalent, expected_reduced;
+    TIME_BEGIN(inclusion_antichains);
+    expected_included = mata::nfa::is_included(lhs, rhs, &alphabet, antichains);
+    TIME_END(inclusion_antichains);
+    TIME_BEGIN(equivalence_antichains);
+    expected_equivalent = mata::nfa::are_equivalent(lhs, rhs, &alphabet, antichains);
+    TIME_END(equivalence_antichains);
+    TIME_BEGIN(equivalence_reduced_antichains);
+    expected_reduced = mata::nfa::are_equivalent(lhs, reduced, &alphabet, antichains);
+    TIME_END(equivalence_reduced_antichains);
+
+    const ParameterMap hkc{ { "algorithm", "hkc" } };
+    const ParameterMap hkc_sim{ { "algorithm", "hkc-sim" } };
+    bool included, equivalent, equivalent_reduced;
+    TIME_BEGIN(inclusion_hkc);
+    included = mata::nfa::is_included(lhs, rhs, &alphabet, hkc);
+    TIME_END(inclusion_hkc);
+    TIME_BEGIN(equivalence_hkc);
+    equivalent = mata::nfa::are_equivalent(lhs, rhs, &alphabet, hkc);
+    TIME_END(equivalence_hkc);
+    TIME_BEGIN(equivalence_reduced_hkc);
+    equivalent_reduced = mata::nfa::are_equivalent(lhs, reduced, &alphabet, hkc);
+    TIME_END(equivalence_reduced_hkc);
+    if (included != expected_included || equivalent != expected_equivalent || equivalent_reduced != expected_reduced) {
+        std::cerr << "Results of hkc differ\n";
+        return EXIT_FAILURE;
+    }
+
+    TIME_BEGIN(inclusion_hkc_sim);
+    included = mata::nfa::is_included(lhs, rhs, &alphabet, hkc_sim);
+    TIME_END(inclusion_hkc_sim);
+    TIME_BEGIN(equivalence_hkc_sim);
+    equivalent = mata::nfa::are_equivalent(lhs, rhs, &alphabet, hkc_sim);
+    TIME_END(equivalence_hkc_sim);
+    TIME_BEGIN(equivalence_reduced_hkc_sim);
+    equivalent_reduced = mata::nfa::are_equivalent(lhs, reduced, &alphabet, hkc_sim);
+    TIME_END(equivalence_reduced_hkc_sim);
+    if (included != expected_included || equivalent != expected_equivalent || equivalent_reduced != expected_reduced) {
+        std::cerr << "Results of hkc-sim differ\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/**
+ * Benchmark: Inclusion, equivalence and universality by antichains with and without simulations.
+ *
+ * The benchmark program checks inclusion of the two input automata in both directions by plain antichains and by
+ *  antichains enhanced with forward simulations ("antichains-sim"), checks that the results agree, and then compares
+ *  both algorithms on the universality of the first automaton.
+ *
+ * Optimal Inputs: inputs/bench-double-automata-inclusion.in
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames {argv[1], argv[2]};
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const Nfa& lhs = automata[0];
+    const Nfa& rhs = automata[1];
+
+    const ParameterMap antichains{ { "algorithm", "antichains" } };
+    const ParameterMap antichains_sim{ { "algorithm", "antichains-sim" } };
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    bool expected_lhs_rhs, expected_rhs_lhs, result_lhs_rhs, result_rhs_lhs;
+    TIME_BEGIN(inclusion_antichains);
+    expected_lhs_rhs = mata::nfa::is_included(lhs, rhs, &alphabet, antichains);
+    expected_rhs_lhs = mata::nfa::is_included(rhs, lhs, &alphabet, antichains);
+    TIME_END(inclusion_antichains);
+
+    TIME_BEGIN(inclusion_antichains_sim);
+    result_lhs_rhs = mata::nfa::is_included(lhs, rhs, &alphabet, antichains_sim);
+    result_rhs_lhs = mata::nfa::is_included(rhs, lhs, &alphabet, antichains_sim);
+    TIME_END(inclusion_antichains_sim);
+
+    if (expected_lhs_rhs != result_lhs_rhs || expected_rhs_lhs != result_rhs_lhs) {
+        std::cerr << "Inclusion results differ\n";
+        return EXIT_FAILURE;
+    }
+
+    TIME_BEGIN(universality_antichains);
+    const bool expected_universal{ lhs.is_universal(alphabet, antichains) };
+    TIME_END(universality_antichains);
+
+    TIME_BEGIN(universality_antichains_sim);
+    const bool result_universal{ lhs.is_universal(alphabet, antichains_sim) };
+    TIME_END(universality_antichains_sim);
+
+    if (expected_universal != result_universal) {
+        std::cerr << "Universality results differ\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,55 @@
+/**
+ * Benchmark: Minimization by the individual algorithms of @c minimize().
+ *
+ * The benchmark program minimizes the input automaton (and its determinization) with the "brzozowski", "hopcroft",
+ *  "valmari" and "auto" algorithms and checks that all results have the same number of states.
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(determinize);
+    const Nfa dfa{ determinize(aut) };
+    TIME_END(determinize);
+
+    for (const auto& [name, input]: { std::pair<std::string, const Nfa&>{ "nfa", aut }, { "dfa", dfa } }) {
+        size_t num_of_states{ 0 };
+        for (const std::string algorithm: { "brzozowski", "hopcroft", "valmari", "auto" }) {
+            const auto start{ std::chrono::system_clock::now() };
+            Nfa result{ minimize(input, { { "algorithm", algorithm } }) };
+            const std::chrono::duration<double> elapsed{ std::chrono::system_clock::now() - start };
+            std::cout << "minimize_" << algorithm << "_" << name << ": " << elapsed.count() << "\n";
+            const size_t result_num_of_states{ result.trim().num_of_states() };
+            if (num_of_states != 0 && result_num_of_states != num_of_states) {
+                std::cerr << "Minimization by " << algorithm << " differs\n";
+                return EXIT_FAILURE;
+            }
+            num_of_states = result_num_of_states;
+        }
+        std::cout << "states_" << name << ": " << num_of_states << "\n";
+    }
+
+    return EXIT_SUCCESS;
+}
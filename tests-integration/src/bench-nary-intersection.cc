@@ -0,0 +1,73 @@
+/**
+ * Benchmark: Intersection of multiple automata (b-param).
+ *
+ * The benchmark program intersects all the input automata and checks emptiness of the result, first by folding the
+ *  binary intersection over intermediate products, then by a single product construction over tuples of states of all
+ *  the automata, without and with trimming on the fly, and finally by exploring the product on the fly until the
+ *  first tuple of final states is found (depth-first and best-first). It checks that the results agree.
+ *
+ * Optimal Inputs: inputs/bench-variadic-bool-comb-intersect.in
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc <= 2) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames;
+    for (int i = 1; i < argc; ++i) {
+        filenames.emplace_back(argv[i]);
+    }
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    std::vector<const Nfa*> nfas;
+    for (const Nfa& aut: automata) { nfas.push_back(&aut); }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    bool expected, result, result_trimmed;
+    TIME_BEGIN(folded_intersection_emptiness);
+    Nfa folded = automata[0];
+    for (size_t i = 1; i < automata.size(); ++i) {
+        folded = intersection(folded, automata[i]);
+    }
+    expected = folded.is_lang_empty();
+    TIME_END(folded_intersection_emptiness);
+
+    TIME_BEGIN(nary_intersection_emptiness);
+    result = mata::nfa::intersection(nfas).is_lang_empty();
+    TIME_END(nary_intersection_emptiness);
+
+    TIME_BEGIN(nary_trimmed_intersection_emptiness);
+    result_trimmed = mata::nfa::intersection(nfas, mata::nfa::EPSILON, true).is_lang_empty();
+    TIME_END(nary_trimmed_intersection_emptiness);
+
+    bool result_dfs, result_best_first;
+    TIME_BEGIN(on_the_fly_dfs_intersection_emptiness);
+    result_dfs = mata::nfa::is_intersection_empty(nfas, nullptr, { { "algorithm", "dfs" } });
+    TIME_END(on_the_fly_dfs_intersection_emptiness);
+
+    TIME_BEGIN(on_the_fly_best_first_intersection_emptiness);
+    result_best_first = mata::nfa::is_intersection_empty(nfas, nullptr, { { "algorithm", "best-first" } });
+    TIME_END(on_the_fly_best_first_intersection_emptiness);
+
+    if (expected != result || expected != result_trimmed || expected != result_dfs
+        || expected != result_best_first) {
+        std::cerr << "Intersection results differ\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
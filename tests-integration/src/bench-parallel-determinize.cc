@@ -0,0 +1,51 @@
+/**
+ * Benchmark: Determinization by the sequential and the multi-threaded subset construction.
+ *
+ * The benchmark program determinizes the input automaton sequentially and with 1, 2, 4, 8 and 16 threads (the
+ *  "threads" parameter of @c determinize()) and checks that all results are the same.
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(determinize_sequential);
+    const Nfa expected{ determinize(aut) };
+    TIME_END(determinize_sequential);
+    std::cout << "macrostates: " << expected.num_of_states() << "\n";
+
+    for (const size_t num_of_threads: { 1ul, 2ul, 4ul, 8ul, 16ul }) {
+        const auto start{ std::chrono::system_clock::now() };
+        const Nfa result{ determinize(aut, nullptr, std::nullopt, { { "threads", std::to_string(num_of_threads) } }) };
+        const std::chrono::duration<double> elapsed{ std::chrono::system_clock::now() - start };
+        std::cout << "determinize_threads_" << num_of_threads << ": " << elapsed.count() << "\n";
+        if (result.num_of_states() != expected.num_of_states() || result.delta != expected.delta
+            || result.final != expected.final) {
+            std::cerr << "Determinization with " << num_of_threads << " threads differs\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,58 @@
+/**
+ * Benchmark: Antichain inclusion run by a single thread and by multiple threads.
+ *
+ * The benchmark program checks inclusion of the first input automaton in the second one by antichains as
+ *  bench-automata-inclusion, and then by antichains run by 2, 4 and 8 threads, and checks that the results agree.
+ *
+ * Optimal Inputs: inputs/bench-double-automata-inclusion.in
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Input files missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> filenames {argv[1], argv[2]};
+    std::vector<Nfa> automata;
+    mata::OnTheFlyAlphabet alphabet;
+    if (load_automata(filenames, automata, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const Nfa& lhs = automata[0];
+    const Nfa& rhs = automata[1];
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(automata_inclusion_antichain);
+    const bool expected{ mata::nfa::is_included(lhs, rhs, &alphabet, { { "algorithm", "antichains" } }) };
+    TIME_END(automata_inclusion_antichain);
+
+    bool result_2, result_4, result_8;
+    TIME_BEGIN(automata_inclusion_antichain_2_threads);
+    result_2 = mata::nfa::is_included(lhs, rhs, &alphabet, { { "algorithm", "antichains" }, { "threads", "2" } });
+    TIME_END(automata_inclusion_antichain_2_threads);
+
+    TIME_BEGIN(automata_inclusion_antichain_4_threads);
+    result_4 = mata::nfa::is_included(lhs, rhs, &alphabet, { { "algorithm", "antichains" }, { "threads", "4" } });
+    TIME_END(automata_inclusion_antichain_4_threads);
+
+    TIME_BEGIN(automata_inclusion_antichain_8_threads);
+    result_8 = mata::nfa::is_included(lhs, rhs, &alphabet, { { "algorithm", "antichains" }, { "threads", "8" } });
+    TIME_END(automata_inclusion_antichain_8_threads);
+
+    if (result_2 != expected || result_4 != expected || result_8 != expected) {
+        std::cerr << "Results differ\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
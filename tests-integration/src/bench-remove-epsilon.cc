@@ -0,0 +1,46 @@
+/**
+ * Benchmark: Removal of epsilon transitions.
+ *
+ * The benchmark program adds epsilon transitions to the input automaton (long epsilon paths and epsilon cycles) and
+ *  removes them by @c remove_epsilon().
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+/// Every EPSILON_STEP-th state gets an epsilon transition.
+constexpr size_t EPSILON_STEP{ 2 };
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const size_t num_of_states{ aut.num_of_states() };
+    for (State source{ 0 }; source < num_of_states; source += EPSILON_STEP) {
+        aut.delta.add(source, mata::nfa::EPSILON, (source + 1) % num_of_states);
+        aut.delta.add(source, mata::nfa::EPSILON, (source * 7 + 3) % num_of_states);
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(remove_epsilon);
+    const Nfa result{ remove_epsilon(aut) };
+    TIME_END(remove_epsilon);
+    std::cout << "transitions: " << result.delta.num_of_transitions() << "\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+/**
+ * Benchmark: Kernels of set operations on ordered vectors.
+ *
+ * The benchmark program compares the scalar and the vectorized (SSE4.2, AVX2) kernels of intersection, intersection
+ *  test and inclusion test on random sorted sets of 32-bit and 64-bit elements of various sizes and overlap ratios.
+ *  Instruction sets not supported by the CPU are skipped.
+ *
+ * The program takes no input. Each reported time is the time of repeating the operation on a set of the given size
+ *  until about the same number of elements is processed for each size.
+ */
+
+#include "utils/utils.hh"
+
+#include "mata/utils/ord-vector.hh"
+
+#include <numeric>
+#include <random>
+
+using mata::utils::set_kernels::Isa;
+namespace set_kernels = mata::utils::set_kernels;
+
+namespace {
+/// Number of elements processed by each measured operation in total.
+constexpr size_t NUM_OF_PROCESSED_ELEMENTS{ size_t{ 1 } << 25 };
+constexpr size_t SET_SIZES[]{ 4, 16, 64, 256, 4096 };
+constexpr double OVERLAP_RATIOS[]{ 0.0, 0.1, 0.5, 0.9, 1.0 };
+
+/// Sink for the results of the measured operations so that they are not optimized away.
+volatile size_t sink{ 0 };
+
+const char* isa_name(const Isa isa) {
+    switch (isa) {
+        case Isa::Scalar: return "scalar";
+        case Isa::Sse42: return "sse42";
+        case Isa::Avx2: return "avx2";
+    }
+    return "unknown";
+}
+
+/**
+ * Time @p repetitions calls of @p operation and print the elapsed time under @p name.
+ */
+template<class Operation>
+void measure(const std::string& name, const size_t repetitions, Operation&& operation) {
+    size_t result{ 0 };
+    const auto start{ std::chrono::system_clock::now() };
+    for (size_t repetition{ 0 }; repetition < repetitions; ++repetition) { result += operation(); }
+    const std::chrono::duration<double> elapsed{ std::chrono::system_clock::now() - start };
+    sink = sink + result;
+    std::cout << name << ": " << elapsed.count() << "\n";
+}
+
+/**
+ * Generate two sorted sets of @p size elements each, sharing @p overlap_ratio of their elements.
+ */
+template<class T>
+std::pair<std::vector<T>, std::vector<T>> generate_sets(std::mt19937& generator, const size_t size,
+                                                        const double overlap_ratio) {
+    // Draw 2 * size distinct values with gaps, so that blocks of both sets interleave.
+    std::vector<T> values(8 * size);
+    std::iota(values.begin(), values.end(), T{ 0 });
+    std::shuffle(values.begin(), values.end(), generator);
+    const auto num_of_shared{ static_cast<size_t>(overlap_ratio * static_cast<double>(size)) };
+    std::vector<T> lhs(values.begin(), values.begin() + static_cast<long>(size));
+    std::vector<T> rhs(values.begin(), values.begin() + static_cast<long>(num_of_shared));
+    rhs.insert(rhs.end(), values.begin() + static_cast<long>(size),
+               values.begin() + static_cast<long>(2 * size - num_of_shared));
+    std::sort(lhs.begin(), lhs.end());
+    std::sort(rhs.begin(), rhs.end());
+    return { lhs, rhs };
+}
+
+template<class T>
+void run_benchmarks(const std::string& type_name) {
+    std::mt19937 generator{ 0 };
+    std::vector<Isa> isas{};
+    for (const Isa isa: { Isa::Scalar, Isa::Sse42, Isa::Avx2 }) {
+        if (set_kernels::is_supported(isa)) { isas.push_back(isa); }
+    }
+
+    for (const size_t size: SET_SIZES) {
+        const size_t repetitions{ NUM_OF_PROCESSED_ELEMENTS / size };
+        for (const double overlap_ratio: OVERLAP_RATIOS) {
+            const auto [lhs, rhs]{ generate_sets<T>(generator, size, overlap_ratio) };
+            std::vector<T> out(size);
+            const std::string suffix{ "_" + type_name + "_" + std::to_string(size) + "_"
+                                      + std::to_string(static_cast<int>(overlap_ratio * 100)) };
+
+            for (const Isa isa: isas) {
+                measure("intersection_" + std::string{ isa_name(isa) } + suffix, repetitions, [&]() {
+                    return set_kernels::intersection(lhs.data(), size, rhs.data(), size, out.data(), isa);
+                });
+                measure("intersects_" + std::string{ isa_name(isa) } + suffix, repetitions, [&]() {
+                    return static_cast<size_t>(set_kernels::intersects(lhs.data(), size, rhs.data(), size, isa));
+                });
+                // lhs is a subset of the union of the sets, so the inclusion test has to walk both sets.
+                std::vector<T> bigger{};
+                std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(bigger));
+                measure("is_subset_" + std::string{ isa_name(isa) } + suffix, repetitions, [&]() {
+                    return static_cast<size_t>(
+                        set_kernels::is_subset(lhs.data(), size, bigger.data(), bigger.size(), isa));
+                });
+            }
+        }
+    }
+}
+} // namespace.
+
+int main() {
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    std::cout << "best_isa: " << isa_name(set_kernels::best_isa()) << "\n";
+    run_benchmarks<uint32_t>("u32");
+    run_benchmarks<uint64_t>("u64");
+
+    return EXIT_SUCCESS;
+}
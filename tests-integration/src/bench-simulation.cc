@@ -0,0 +1,71 @@
+/**
+ * Benchmark: Direct simulation by Simlib's @c ExplicitLTS and by @c compute_direct_simulation() over @c Delta.
+ *
+ * The benchmark program computes the forward direct simulation of the input automaton by copying the transitions
+ *  into an @c ExplicitLTS (with a self-loop over an unused symbol on final states), and directly over the transition
+ *  relation. It checks that both relations are the same, and then reduces the automaton by simulation.
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+#include "mata/simlib/explicit_lts.hh"
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    TIME_BEGIN(simulation_explicit_lts);
+    Simlib::ExplicitLTS lts(aut.num_of_states());
+    mata::Symbol unused_symbol{ 0 };
+    aut.delta.for_each_transition([&](const State source, const mata::Symbol symbol, const State target) {
+        lts.add_transition(source, symbol, target);
+        unused_symbol = std::max(unused_symbol, symbol + 1);
+    });
+    for (const State state: aut.final) { lts.add_transition(state, unused_symbol, state); }
+    lts.init();
+    const Simlib::Util::BinaryRelation expected{ lts.compute_simulation() };
+    TIME_END(simulation_explicit_lts);
+
+    TIME_BEGIN(simulation_delta);
+    const Simlib::Util::BinaryRelation result{ algorithms::compute_relation(aut) };
+    TIME_END(simulation_delta);
+
+    for (size_t row{ 0 }; row < aut.num_of_states(); ++row) {
+        for (size_t column{ 0 }; column < aut.num_of_states(); ++column) {
+            if (result.get(row, column) != expected.get(row, column)) {
+                std::cerr << "Simulations differ\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    TIME_BEGIN(simulation_backward);
+    algorithms::compute_relation(aut, { { "relation", "simulation" }, { "direction", "backward" } });
+    TIME_END(simulation_backward);
+
+    TIME_BEGIN(reduce_simulation);
+    const Nfa reduced{ reduce(aut) };
+    TIME_END(reduce_simulation);
+    std::cout << "states: " << aut.num_of_states() << " -> " << reduced.num_of_states() << "\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+/**
+ * Benchmark: Traversal of all transitions by the transition iterator, the transition visitor and in parallel chunks.
+ *
+ * The benchmark program sums sources, symbols and targets of all transitions of the input automaton and of a large
+ *  random automaton, iterating over @c Delta::transitions(), by @c Delta::for_each_transition() and by
+ *  @c Delta::reduce_by_chunks() with the number of hardware threads.
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+#include <random>
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+/// Number of traversals measured by each timer.
+constexpr size_t NUM_OF_TRAVERSALS{ 10 };
+/// Parameters of the random automaton.
+constexpr size_t RANDOM_NUM_OF_STATES{ 100000 };
+constexpr size_t RANDOM_ALPHABET_SIZE{ 4 };
+constexpr size_t RANDOM_TRANSITIONS_PER_STATE{ 10 };
+
+namespace {
+size_t checksum_by_iterator(const Delta& delta) {
+    size_t checksum{ 0 };
+    for (const Transition& transition: delta.transitions()) {
+        checksum += transition.source + transition.symbol + transition.target;
+    }
+    return checksum;
+}
+
+size_t checksum_by_visitor(const Delta& delta) {
+    size_t checksum{ 0 };
+    delta.for_each_transition([&](const State source, const mata::Symbol symbol, const State target) {
+        checksum += source + symbol + target;
+    });
+    return checksum;
+}
+
+size_t checksum_by_chunks(const Delta& delta) {
+    return delta.reduce_by_chunks(size_t{ 0 }, [&](const State first_source, const State last_source) {
+        size_t checksum{ 0 };
+        delta.for_each_transition(first_source, last_source,
+                                  [&](const State source, const mata::Symbol symbol, const State target) {
+            checksum += source + symbol + target;
+        });
+        return checksum;
+    }, [](size_t& checksum, const size_t chunk_checksum) { checksum += chunk_checksum; });
+}
+
+int measure(const std::string& prefix, const Delta& delta) {
+    size_t iterator_checksum{ 0 };
+    size_t visitor_checksum{ 0 };
+    size_t chunks_checksum{ 0 };
+    std::cout << prefix << "transitions: " << delta.num_of_transitions() << "\n";
+    TIME_BEGIN(iterator);
+    for (size_t traversal{ 0 }; traversal < NUM_OF_TRAVERSALS; ++traversal) {
+        iterator_checksum += checksum_by_iterator(delta);
+    }
+    TIME_END(iterator);
+    TIME_BEGIN(visitor);
+    for (size_t traversal{ 0 }; traversal < NUM_OF_TRAVERSALS; ++traversal) {
+        visitor_checksum += checksum_by_visitor(delta);
+    }
+    TIME_END(visitor);
+    TIME_BEGIN(chunks);
+    for (size_t traversal{ 0 }; traversal < NUM_OF_TRAVERSALS; ++traversal) {
+        chunks_checksum += checksum_by_chunks(delta);
+    }
+    TIME_END(chunks);
+    if (iterator_checksum != visitor_checksum || iterator_checksum != chunks_checksum) {
+        std::cerr << "Traversals of " << prefix << "transitions differ\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+} // namespace.
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    if (measure("", aut.delta) != EXIT_SUCCESS) { return EXIT_FAILURE; }
+
+    // The Tabakov-Vardi generator is quadratic in the number of states, hence the random transitions are generated here.
+    std::mt19937 generator{ 0 };
+    std::uniform_int_distribution<State> random_state{ 0, RANDOM_NUM_OF_STATES - 1 };
+    std::uniform_int_distribution<mata::Symbol> random_symbol{ 0, RANDOM_ALPHABET_SIZE - 1 };
+    std::vector<Transition> random_transitions{};
+    random_transitions.reserve(RANDOM_NUM_OF_STATES * RANDOM_TRANSITIONS_PER_STATE);
+    for (State source{ 0 }; source < RANDOM_NUM_OF_STATES; ++source) {
+        for (size_t index{ 0 }; index < RANDOM_TRANSITIONS_PER_STATE; ++index) {
+            random_transitions.emplace_back(source, random_symbol(generator), random_state(generator));
+        }
+    }
+    Delta random_delta{};
+    random_delta.add_bulk(std::move(random_transitions));
+    return measure("random_", random_delta);
+}
@@ -0,0 +1,57 @@
+/**
+ * Benchmark: Universality by antichains.
+ *
+ * The benchmark program checks universality of the input automaton and of its union with its complement (which is
+ *  universal, so the whole antichain has to be explored) by antichains over sorted-vector and adaptive macrostates,
+ *  and checks that the results agree.
+ *
+ * Optimal Inputs: inputs/single-automata.input
+ *
+ * NOTE: Input automata, that are of type `NFA-bits` are mintermized!
+ *  - If you want to skip mintermization, set the variable `MINTERMIZE_AUTOMATA` below to `false`
+ */
+
+#include "utils/utils.hh"
+
+#include <array>
+
+constexpr bool MINTERMIZE_AUTOMATA{ true };
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "Input file missing\n";
+        return EXIT_FAILURE;
+    }
+
+    std::string filename = argv[1];
+    Nfa aut;
+    mata::OnTheFlyAlphabet alphabet{};
+    if (load_automaton(filename, aut, alphabet, MINTERMIZE_AUTOMATA) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    const Nfa universal{ mata::nfa::union_nondet(aut, mata::nfa::complement(aut, alphabet)) };
+
+    const ParameterMap antichains{ { "algorithm", "antichains" } };
+    const ParameterMap antichains_adaptive{ { "algorithm", "antichains" }, { "macrostate", "adaptive" } };
+
+    // Setting precision of the times to fixed points and 4 decimal places
+    std::cout << std::fixed << std::setprecision(4);
+
+    for (const Nfa* input: std::array<const Nfa*, 2>{ &aut, &universal }) {
+        bool result_antichains, result_adaptive;
+        TIME_BEGIN(universality_antichains);
+        result_antichains = input->is_universal(alphabet, antichains);
+        TIME_END(universality_antichains);
+
+        TIME_BEGIN(universality_antichains_adaptive);
+        result_adaptive = input->is_universal(alphabet, antichains_adaptive);
+        TIME_END(universality_antichains_adaptive);
+
+        if (result_antichains != result_adaptive) {
+            std::cerr << "Universality results differ\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
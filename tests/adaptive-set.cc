@@ -0,0 +1,109 @@
+/* tests-adaptive-set.cc -- tests of AdaptiveSet
+ */
+
+#include <numeric>
+#include <unordered_set>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/utils/adaptive-set.hh"
+#include "mata/utils/ord-vector.hh"
+#include "mata/utils/sparse-set.hh"
+
+using namespace mata::utils;
+
+TEST_CASE("mata::utils::AdaptiveSet") {
+    using Set = AdaptiveSet<unsigned long>;
+    using Vector = OrdVector<unsigned long>;
+
+    std::vector<unsigned long> numbers(100);
+    std::iota(numbers.begin(), numbers.end(), 0);
+    const Vector dense_elements{ numbers };
+    const Vector sparse_elements{ 3, 64, 200, 50000 };
+
+    SECTION("Form and iteration") {
+        CHECK(Set{}.empty());
+        CHECK(Set{}.begin() == Set{}.end());
+
+        const Set sparse{ sparse_elements };
+        CHECK(!sparse.is_dense());
+        CHECK(sparse.size() == 4);
+        CHECK(sparse.to_ord_vector() == sparse_elements);
+        CHECK(sparse.contains(200));
+        CHECK(!sparse.contains(201));
+
+        const Set dense{ dense_elements };
+        CHECK(dense.is_dense());
+        CHECK(dense.size() == 100);
+        CHECK(dense.to_ord_vector() == dense_elements);
+        CHECK(dense.contains(99));
+        CHECK(!dense.contains(100));
+        CHECK(!dense.contains(100000));
+
+        // A bitset is used when it is not bigger than the sorted vector.
+        CHECK(Set{ Vector{ 0, 127 } }.is_dense());
+        CHECK(!Set{ Vector{ 0, 128 } }.is_dense());
+    }
+
+    SECTION("Builder") {
+        Set::Builder builder{ 100 };
+        CHECK(builder.empty());
+        CHECK(builder.build().empty());
+
+        for (const unsigned long number: { 50000ul, 3ul, 200ul, 64ul, 3ul }) { builder.insert(number); }
+        const Set sparse{ builder.build() };
+        CHECK(builder.empty());
+        CHECK(sparse == Set{ sparse_elements });
+        CHECK(sparse.hash() == Set{ sparse_elements }.hash());
+
+        builder.insert(Set{ dense_elements });
+        builder.insert(sparse_elements);
+        const Set united{ builder.build() };
+        Vector united_elements{ dense_elements };
+        united_elements.insert(sparse_elements);
+        CHECK(united.to_ord_vector() == united_elements);
+        CHECK(!united.is_dense());
+
+        builder.insert(dense_elements);
+        builder.clear();
+        builder.insert(7);
+        CHECK(builder.build() == Set{ Vector{ 7 } });
+    }
+
+    SECTION("Subsets") {
+        const Set sparse{ sparse_elements };
+        const Set dense{ dense_elements };
+        const Set dense_subset{ Vector{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 } };
+        REQUIRE(dense_subset.is_dense());
+        Vector big_elements{ dense_elements };
+        big_elements.insert(sparse_elements);
+        const Set big{ big_elements };
+        REQUIRE(!big.is_dense());
+
+        CHECK(dense_subset.is_subset_of(dense));
+        CHECK(!dense.is_subset_of(dense_subset));
+        CHECK(Set{ Vector{ 3, 64 } }.is_subset_of(sparse));
+        CHECK(!Set{ Vector{ 3, 65 } }.is_subset_of(sparse));
+        CHECK(Set{ Vector{ 3, 64, 50000 } }.is_subset_of(big));
+        CHECK(dense.is_subset_of(big));
+        CHECK(!big.is_subset_of(dense));
+        CHECK(Set{ Vector{ 3, 50 } }.is_subset_of(dense));
+        CHECK(!Set{ Vector{ 3, 500 } }.is_subset_of(dense));
+        CHECK(Set{}.is_subset_of(sparse));
+        CHECK(!dense.is_subset_of(Set{}));
+    }
+
+    SECTION("Hashing and ordering") {
+        std::unordered_set<Set> sets{ Set{ sparse_elements }, Set{ dense_elements }, Set{} };
+        CHECK(sets.size() == 3);
+        CHECK(sets.contains(Set{ Vector{ 3, 64, 200, 50000 } }));
+        CHECK(!sets.contains(Set{ Vector{ 3, 64, 200 } }));
+        CHECK(Set{ Vector{ 1, 2 } } < Set{ Vector{ 1, 3 } });
+        CHECK(Set{ Vector{ 1, 2 } } < Set{ Vector{ 1, 2, 3 } });
+        CHECK(Set{ dense_elements } < Set{ sparse_elements });
+
+        SparseSet<unsigned long> final{ 64, 99 };
+        CHECK(Set{ sparse_elements }.intersects_with(final));
+        CHECK(!Set{ Vector{ 3, 50000 } }.intersects_with(final));
+    }
+}
@@ -0,0 +1,73 @@
+/* tests-antichain.cc -- tests of Antichain
+ */
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/utils/antichain.hh"
+#include "mata/utils/adaptive-set.hh"
+#include "mata/utils/ord-vector.hh"
+
+using namespace mata::utils;
+
+using Set = OrdVector<unsigned long>;
+
+TEST_CASE("mata::utils::Antichain") {
+    Antichain<Set> antichain{};
+    std::vector<size_t> erased{};
+    auto on_erased = [&](const size_t id) { erased.push_back(id); };
+
+    SECTION("Empty antichain") {
+        CHECK(antichain.empty());
+        CHECK(!antichain.contains_subset_of(Set{}));
+        CHECK(!antichain.contains_subset_of(Set{ 1, 2 }));
+    }
+
+    SECTION("Subsets and supersets") {
+        antichain.insert(Set{ 1, 2 }, 0);
+        antichain.insert(Set{ 3 }, 1);
+        antichain.insert(Set{ 65, 66, 130 }, 2);
+        CHECK(antichain.size() == 3);
+        CHECK(antichain.contains_subset_of(Set{ 1, 2 }));
+        CHECK(antichain.contains_subset_of(Set{ 0, 1, 2 }));
+        CHECK(antichain.contains_subset_of(Set{ 3, 4 }));
+        CHECK(!antichain.contains_subset_of(Set{ 1 }));
+        CHECK(!antichain.contains_subset_of(Set{ 2, 4 }));
+        // The same signature as { 65, 66, 130 }, but not a superset of it.
+        CHECK(!antichain.contains_subset_of(Set{ 2, 65, 130 }));
+        CHECK(antichain.contains_subset_of(Set{ 0, 65, 66, 130 }));
+
+        antichain.erase_supersets_of(Set{ 2 }, on_erased);
+        CHECK(erased == std::vector<size_t>{ 0 });
+        CHECK(antichain.size() == 2);
+        CHECK(!antichain.contains_subset_of(Set{ 1, 2 }));
+
+        antichain.erase_supersets_of(Set{ 65, 130 }, on_erased);
+        CHECK(erased == std::vector<size_t>{ 0, 2 });
+        antichain.erase_supersets_of(Set{ 3, 4 }, on_erased);
+        CHECK(erased == std::vector<size_t>{ 0, 2 });
+        antichain.erase_supersets_of(Set{}, on_erased);
+        CHECK(erased == std::vector<size_t>{ 0, 2, 1 });
+        CHECK(antichain.empty());
+    }
+
+    SECTION("Custom relations") {
+        antichain.insert(Set{ 1, 2 }, 0);
+        antichain.insert(Set{ 3 }, 1);
+        antichain.insert(Set{ 4 }, 2);
+        CHECK(antichain.any_of([](const Set& set, const size_t id) { return set.size() == 1 && id == 2; }));
+        CHECK(!antichain.any_of([](const Set& set, size_t) { return set.size() == 3; }));
+        antichain.erase_if([](const Set& set, size_t) { return set.size() == 1; }, on_erased);
+        CHECK(erased.size() == 2);
+        CHECK(antichain.size() == 1);
+        CHECK(antichain.contains_subset_of(Set{ 1, 2, 3 }));
+    }
+
+    SECTION("Adaptive sets") {
+        Antichain<AdaptiveSet<unsigned long>> adaptive{};
+        adaptive.insert(AdaptiveSet<unsigned long>{ Set{ 0, 1, 2, 3 } }, 0);
+        CHECK(adaptive.contains_subset_of(AdaptiveSet<unsigned long>{ Set{ 0, 1, 2, 3, 4 } }));
+        CHECK(!adaptive.contains_subset_of(AdaptiveSet<unsigned long>{ Set{ 0, 1, 2, 100 } }));
+    }
+}
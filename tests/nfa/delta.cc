@@ -25,6 +25,17 @@ TEST_CASE("mata::nfa::SymbolPost") {
     CHECK(SymbolPost{ 1, StateSet{ 0 } } >= SymbolPost{ 0, StateSet{ 1 } });
 }
 
+TEST_CASE("mata::nfa::SymbolPost::targets") {
+    SymbolPost symbol_post{ 0, 1 };
+    CHECK(symbol_post.targets.to_vector().is_inline());
+    symbol_post.insert(StateSet{ 3, 2 });
+    CHECK(symbol_post.targets == StateSet{ 1, 2, 3 });
+    symbol_post.insert(0);
+    CHECK(symbol_post.targets == StateSet{ 0, 1, 2, 3 });
+    const StateSet targets{ symbol_post.targets };
+    CHECK(SymbolPost{ 0, targets }.targets == symbol_post.targets);
+}
+
 TEST_CASE("mata::nfa::Delta::state_post()") {
     Nfa aut{};
 
@@ -483,3 +494,191 @@ TEST_CASE("Transition comparison") {
     CHECK(tr5 <= tr4);
     CHECK(tr5 == tr4);
 }
+
+TEST_CASE("mata::nfa::Delta::add_bulk()") {
+    Delta delta{};
+    Delta expected{};
+
+    SECTION("Empty") {
+        delta.add_bulk({});
+        CHECK(delta.empty());
+        CHECK(delta.num_of_states() == 0);
+    }
+
+    SECTION("Unsorted transitions with duplicates") {
+        std::vector<Transition> transitions{
+            { 3, 'b', 1 }, { 0, 'a', 2 }, { 0, 'a', 1 }, { 3, 'a', 7 }, { 0, 'b', 0 }, { 0, 'a', 2 }, { 3, 'b', 0 },
+            { 5, EPSILON, 5 }, { 0, 'a', 1 },
+        };
+        for (const Transition& transition: transitions) { expected.add(transition); }
+        delta.add_bulk(std::move(transitions));
+        CHECK(delta == expected);
+        CHECK(delta.num_of_states() == 8);
+        CHECK(delta.num_of_transitions() == 7);
+        CHECK(delta[0].find('a')->targets == StateSet{ 1, 2 });
+    }
+
+    SECTION("Into non-empty delta") {
+        for (Delta* const initialized: { &delta, &expected }) {
+            initialized->add(0, 'a', 1);
+            initialized->add(0, 'c', 0);
+            initialized->add(2, 'b', 2);
+        }
+        std::vector<Transition> transitions{ { 0, 'b', 1 }, { 0, 'a', 0 }, { 0, 'a', 1 }, { 2, 'a', 9 }, { 4, 'a', 0 } };
+        for (const Transition& transition: transitions) { expected.add(transition); }
+        delta.add_bulk(std::move(transitions));
+        CHECK(delta == expected);
+        CHECK(delta.num_of_states() == 10);
+    }
+}
+
+TEST_CASE("mata::nfa::Delta::for_each_transition()") {
+    Delta delta{};
+    delta.add(0, 'a', 1);
+    delta.add(0, 'a', 2);
+    delta.add(0, 'b', 0);
+    delta.add(3, 'a', 3);
+    delta.add(3, EPSILON, 0);
+
+    std::vector<Transition> visited{};
+    delta.for_each_transition([&](const State source, const Symbol symbol, const State target) {
+        visited.emplace_back(source, symbol, target);
+    });
+    CHECK(visited == std::vector<Transition>{ delta.transitions().begin(), delta.transitions().end() });
+
+    visited.clear();
+    delta.for_each_transition(1, 4, [&](const State source, const Symbol symbol, const State target) {
+        visited.emplace_back(source, symbol, target);
+    });
+    CHECK(visited == std::vector<Transition>{ { 3, 'a', 3 }, { 3, EPSILON, 0 } });
+
+    std::vector<Move> moves{};
+    delta.for_each_move(0, [&](const Symbol symbol, const State target) { moves.push_back({ symbol, target }); });
+    CHECK(moves == std::vector<Move>{ delta[0].moves().begin(), delta[0].moves().end() });
+    moves.clear();
+    delta.for_each_move(42, [&](const Symbol symbol, const State target) { moves.push_back({ symbol, target }); });
+    CHECK(moves.empty());
+}
+
+TEST_CASE("mata::nfa::Delta::reduce_by_chunks()") {
+    const size_t num_of_states{ 10 * Delta::MIN_STATES_PER_CHUNK };
+    Nfa aut{};
+    std::vector<Transition> transitions{};
+    for (State source{ 0 }; source < num_of_states; ++source) {
+        transitions.emplace_back(source, 'a', static_cast<State>((source * 7 + 1) % num_of_states));
+        transitions.emplace_back(source, 'a', static_cast<State>((source + 3) % num_of_states));
+        if (source % 5 == 0) { transitions.emplace_back(source, 'b', source / 2); }
+    }
+    aut.delta.add_bulk(std::move(transitions));
+    const Delta& delta{ aut.delta };
+
+    SECTION("Chunks cover all states") {
+        for (const size_t num_of_chunks: { 1ul, 2ul, 3ul, 10ul, 100ul }) {
+            const std::vector<std::pair<State, State>> chunks{ delta.split_into_chunks(num_of_chunks) };
+            CHECK(chunks.size() == std::min(num_of_chunks, size_t{ 10 }));
+            CHECK(chunks.front().first == 0);
+            CHECK(chunks.back().second == delta.num_of_states());
+            for (size_t chunk_index{ 1 }; chunk_index < chunks.size(); ++chunk_index) {
+                CHECK(chunks[chunk_index - 1].second == chunks[chunk_index].first);
+                CHECK(chunks[chunk_index].first < chunks[chunk_index].second);
+            }
+        }
+        CHECK(Delta{}.split_into_chunks(4) == std::vector<std::pair<State, State>>{ { 0, 0 } });
+    }
+
+    SECTION("Reverse building") {
+        const auto reverse_chunk = [&](const State first_source, const State last_source) {
+            std::vector<Transition> reversed{};
+            delta.for_each_transition(first_source, last_source,
+                                      [&](const State source, const Symbol symbol, const State target) {
+                reversed.emplace_back(target, symbol, source);
+            });
+            return reversed;
+        };
+        const auto append = [](std::vector<Transition>& reversed, const std::vector<Transition>& chunk_reversed) {
+            reversed.insert(reversed.end(), chunk_reversed.begin(), chunk_reversed.end());
+        };
+        const std::vector<Transition> sequential{ delta.reduce_by_chunks(std::vector<Transition>{}, reverse_chunk,
+                                                                          append, 1) };
+        CHECK(sequential.size() == delta.num_of_transitions());
+        CHECK(delta.reduce_by_chunks(std::vector<Transition>{}, reverse_chunk, append, 4) == sequential);
+        Delta reverted{};
+        reverted.add_bulk(std::vector<Transition>{ sequential });
+        CHECK(reverted == revert(aut).delta);
+    }
+
+    SECTION("Exceptions are rethrown") {
+        CHECK_THROWS_AS(delta.reduce_by_chunks(0, [](const State first_source, State) -> int {
+            if (first_source != 0) { throw std::runtime_error("chunk failed"); }
+            return 0;
+        }, [](int&, int) {}, 4), std::runtime_error);
+    }
+
+    CHECK(delta.get_used_symbols_par() == delta.get_used_symbols_vec());
+}
+
+TEST_CASE("mata::nfa::FrozenDelta") {
+    Delta delta{};
+    delta.add(0, 'a', 1);
+    delta.add(0, 'a', 2);
+    delta.add(0, 'b', 0);
+    delta.add(2, 'c', 3);
+    delta.add(2, EPSILON, 0);
+    delta.add(2, EPSILON - 1, 1);
+
+    SECTION("Empty delta") {
+        const FrozenDelta frozen{ Delta{}.freeze() };
+        CHECK(frozen.empty());
+        CHECK(frozen.num_of_states() == 0);
+        CHECK(frozen.num_of_transitions() == 0);
+        CHECK(frozen[0].empty());
+        CHECK(frozen.thaw().empty());
+    }
+
+    SECTION("Snapshot contents") {
+        const FrozenDelta frozen{ delta.freeze() };
+        CHECK(!frozen.empty());
+        CHECK(frozen.num_of_states() == delta.num_of_states());
+        CHECK(frozen.num_of_transitions() == delta.num_of_transitions());
+        CHECK(frozen[0].size() == 2);
+        CHECK(frozen[1].empty());
+        CHECK(frozen[3].empty());
+        CHECK(frozen[42].empty());
+        CHECK(frozen.contains(0, 'a', 1));
+        CHECK(frozen.contains(0, 'a', 2));
+        CHECK(frozen.contains(2, EPSILON, 0));
+        CHECK(!frozen.contains(0, 'a', 0));
+        CHECK(!frozen.contains(0, 'c', 3));
+        CHECK(!frozen.contains(42, 'a', 0));
+        for (const Transition& transition: delta.transitions()) {
+            CHECK(frozen.contains(transition.source, transition.symbol, transition.target));
+        }
+        CHECK(frozen.thaw() == delta);
+
+        const auto symbol_post_it{ frozen[0].find('a') };
+        REQUIRE(symbol_post_it != frozen[0].end());
+        CHECK(std::vector<State>(symbol_post_it->begin(), symbol_post_it->end()) == std::vector<State>{ 1, 2 });
+        CHECK(frozen[0].find('c') == frozen[0].end());
+
+        CHECK(frozen[2].first_epsilon_it(EPSILON) - frozen[2].begin() == 2);
+        CHECK(frozen[2].first_epsilon_it(EPSILON - 1) - frozen[2].begin() == 1);
+        CHECK(frozen[0].first_epsilon_it(EPSILON) == frozen[0].end());
+    }
+
+    SECTION("Snapshot is independent of the original delta") {
+        FrozenDelta frozen{ delta.freeze() };
+        delta.add(1, 'a', 1);
+        CHECK(!frozen.contains(1, 'a', 1));
+        CHECK(frozen.num_of_transitions() + 1 == delta.num_of_transitions());
+    }
+
+    SECTION("Copies own their targets") {
+        auto frozen{ std::make_unique<FrozenDelta>(delta.freeze()) };
+        const FrozenDelta copy{ *frozen };
+        FrozenDelta assigned{};
+        assigned = *frozen;
+        frozen.reset();
+        CHECK(copy.thaw() == delta);
+        CHECK(assigned.thaw() == delta);
+    }
+}
@@ -8,6 +8,7 @@
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "mata/nfa/nfa.hh"
+#include "mata/nfa/builder.hh"
 
 using namespace mata::nfa;
 using namespace mata::utils;
@@ -273,6 +274,170 @@ TEST_CASE("mata::nfa::intersection() with preserving epsilon transitions")
     CHECK(result.delta.state_post(prod_map[{ 5, 8 }]).empty());
 }
 
+TEST_CASE("mata::nfa::intersection() and mata::nfa::union_product() of multiple NFAs")
+{
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+
+    SECTION("Empty inputs") {
+        CHECK_THROWS_AS(intersection(std::vector<const Nfa*>{}), std::runtime_error);
+        const Nfa empty{};
+        CHECK(intersection({ &a, &empty, &b }).num_of_states() == 0);
+        CHECK(union_product({ &empty }).num_of_states() == 0);
+        CHECK(are_equivalent(union_product({ &a, &empty }), a));
+    }
+
+    SECTION("Two NFAs give the binary product") {
+        std::unordered_map<std::pair<State, State>, State> prod_map;
+        const Nfa expected{ intersection(a, b, EPSILON, &prod_map) };
+        const Nfa result{ intersection({ &a, &b }) };
+        CHECK(result.num_of_states() == expected.num_of_states());
+        CHECK(result.delta.num_of_transitions() == expected.delta.num_of_transitions());
+        CHECK(result.final.size() == expected.final.size());
+        CHECK(are_equivalent(result, expected));
+        CHECK(are_equivalent(union_product({ &a, &b }), union_product(a, b)));
+    }
+
+    SECTION("Epsilon transitions are preserved") {
+        Nfa c{ 6 };
+        c.initial.insert(0);
+        c.final.insert({ 1, 4, 5 });
+        c.delta.add(0, EPSILON, 1);
+        c.delta.add(1, 'a', 1);
+        c.delta.add(1, 'b', 1);
+        c.delta.add(1, 'c', 2);
+        c.delta.add(2, 'b', 4);
+        c.delta.add(2, EPSILON, 3);
+        c.delta.add(3, 'a', 5);
+
+        Nfa d{ 10 };
+        d.initial.insert(0);
+        d.final.insert({ 2, 4, 8, 7 });
+        d.delta.add(0, 'b', 1);
+        d.delta.add(0, 'a', 2);
+        d.delta.add(2, 'a', 4);
+        d.delta.add(2, EPSILON, 3);
+        d.delta.add(3, 'b', 4);
+        d.delta.add(0, 'c', 5);
+        d.delta.add(5, 'a', 8);
+        d.delta.add(5, EPSILON, 6);
+        d.delta.add(6, 'a', 9);
+        d.delta.add(6, 'b', 7);
+
+        const Nfa result{ intersection({ &c, &d }) };
+        CHECK(result.num_of_states() == 13);
+        CHECK(result.final.size() == 4);
+        CHECK(result.delta.num_of_transitions() == 14);
+        CHECK(are_equivalent(remove_epsilon(result), remove_epsilon(intersection(c, d))));
+    }
+
+    SECTION("Random NFAs give the folded binary product") {
+        for (size_t i{ 0 }; i < 10; ++i) {
+            std::vector<Nfa> nfas{};
+            for (size_t j{ 0 }; j < 3; ++j) {
+                nfas.push_back(mata::nfa::builder::create_random_nfa_tabakov_vardi(8, 2, 1.5, 0.5));
+            }
+            const std::vector<const Nfa*> nfa_ptrs{ &nfas[0], &nfas[1], &nfas[2] };
+
+            Nfa folded_intersection{ nfas[0] };
+            Nfa folded_union{ nfas[0] };
+            for (size_t j{ 1 }; j < nfas.size(); ++j) {
+                folded_intersection = intersection(folded_intersection, nfas[j]);
+                folded_union = union_product(folded_union, nfas[j]);
+            }
+
+            CHECK(are_equivalent(intersection(nfa_ptrs), folded_intersection));
+            CHECK(are_equivalent(union_product(nfa_ptrs), folded_union));
+
+            Nfa trimmed{ intersection(nfa_ptrs, EPSILON, true) };
+            CHECK(are_equivalent(trimmed, folded_intersection));
+            CHECK(trimmed.num_of_states() == Nfa{ folded_intersection }.trim().num_of_states());
+            CHECK(trimmed.num_of_states() == Nfa{ trimmed }.trim().num_of_states());
+        }
+    }
+}
+
+TEST_CASE("mata::nfa::is_intersection_empty()")
+{
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+    const std::vector<ParameterMap> params_list{ {{ "algorithm", "dfs" }}, {{ "algorithm", "best-first" }} };
+
+    SECTION("Invalid inputs") {
+        CHECK_THROWS_AS(is_intersection_empty(std::vector<const Nfa*>{}), std::runtime_error);
+        CHECK_THROWS_AS(is_intersection_empty({ &a }, nullptr, {}), std::runtime_error);
+        CHECK_THROWS_AS(is_intersection_empty({ &a }, nullptr, {{ "algorithm", "foo" }}), std::runtime_error);
+    }
+
+    SECTION("Empty NFA") {
+        const Nfa empty{};
+        for (const ParameterMap& params: params_list) {
+            CHECK(is_intersection_empty({ &a, &empty, &b }, nullptr, params));
+        }
+    }
+
+    SECTION("Non-empty intersection") {
+        for (const ParameterMap& params: params_list) {
+            Run cex{};
+            CHECK(!is_intersection_empty({ &a, &b, &a }, &cex, params));
+            CHECK(a.is_in_lang(cex));
+            CHECK(b.is_in_lang(cex));
+        }
+    }
+
+    SECTION("Empty intersection") {
+        Nfa c{ 2, { 0 }, { 1 } };
+        c.delta.add(0, 'a', 1);
+        c.delta.add(1, 'a', 1);
+        Nfa d{ 2, { 0 }, { 1 } };
+        d.delta.add(0, 'b', 1);
+        d.delta.add(1, 'a', 1);
+        for (const ParameterMap& params: params_list) {
+            Run cex{};
+            CHECK(is_intersection_empty({ &c, &d }, &cex, params));
+            CHECK(!is_intersection_empty({ &c, &c }, &cex, params));
+            CHECK(cex.word == mata::Word{ 'a' });
+        }
+    }
+
+    SECTION("Epsilon transitions") {
+        Nfa c{ 4, { 0 }, { 3 } };
+        c.delta.add(0, EPSILON, 1);
+        c.delta.add(1, 'a', 2);
+        c.delta.add(2, EPSILON, 3);
+        Nfa d{ 3, { 0 }, { 2 } };
+        d.delta.add(0, 'a', 1);
+        d.delta.add(1, EPSILON, 2);
+        for (const ParameterMap& params: params_list) {
+            Run cex{};
+            CHECK(!is_intersection_empty({ &c, &d }, &cex, params));
+            CHECK(cex.word == mata::Word{ 'a' });
+        }
+    }
+
+    SECTION("Random NFAs agree with the emptiness of the product") {
+        for (size_t i{ 0 }; i < 20; ++i) {
+            std::vector<Nfa> nfas{};
+            for (size_t j{ 0 }; j < 3; ++j) {
+                nfas.push_back(mata::nfa::builder::create_random_nfa_tabakov_vardi(8, 2, 1.5, 0.3));
+            }
+            const std::vector<const Nfa*> nfa_ptrs{ &nfas[0], &nfas[1], &nfas[2] };
+            const bool expected{ intersection(nfa_ptrs).is_lang_empty() };
+            for (const ParameterMap& params: params_list) {
+                Run cex{};
+                CHECK(is_intersection_empty(nfa_ptrs, &cex, params) == expected);
+                if (!expected) {
+                    for (const Nfa& nfa: nfas) { CHECK(nfa.is_in_lang(cex)); }
+                }
+            }
+        }
+    }
+}
+
 TEST_CASE("mata::nfa::intersection() for profiling", "[.profiling],[intersection]")
 {
     Nfa a{6};
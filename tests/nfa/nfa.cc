@@ -1,5 +1,6 @@
 // TODO: some header
 
+#include <numeric>
 #include <unordered_set>
 
 #include <catch2/catch_test_macros.hpp>
@@ -15,6 +16,7 @@
 #include "mata/nfa/plumbing.hh"
 #include "mata/nfa/algorithms.hh"
 #include "mata/parser/re2parser.hh"
+#include "mata/simlib/explicit_lts.hh"
 
 using namespace mata;
 using namespace mata::nfa::algorithms;
@@ -2768,6 +2770,64 @@ TEST_CASE("mata::nfa::fw-direct-simulation()")
     }
 } // }}
 
+TEST_CASE("mata::nfa::algorithms::compute_direct_simulation()") {
+    // Reference simulation computed by Simlib over an LTS with an extra self-loop on the distinguished states.
+    const auto reference_simulation = [](const Nfa& aut, const SparseSet<State>& distinguished) {
+        Simlib::ExplicitLTS lts(aut.num_of_states());
+        Symbol unused_symbol{ 0 };
+        aut.delta.for_each_transition([&](const State source, const Symbol symbol, const State target) {
+            lts.add_transition(source, symbol, target);
+            unused_symbol = std::max(unused_symbol, symbol + 1);
+        });
+        for (const State state: distinguished) { lts.add_transition(state, unused_symbol, state); }
+        lts.init();
+        return lts.compute_simulation();
+    };
+    const auto same_relations = [](const Simlib::Util::BinaryRelation& lhs, const Simlib::Util::BinaryRelation& rhs) {
+        if (lhs.size() != rhs.size()) { return false; }
+        for (size_t row{ 0 }; row < lhs.size(); ++row) {
+            for (size_t column{ 0 }; column < lhs.size(); ++column) {
+                if (lhs.get(row, column) != rhs.get(row, column)) { return false; }
+            }
+        }
+        return true;
+    };
+
+    for (const size_t num_of_states: { 3ul, 10ul, 30ul, 70ul }) {
+        for (const double transition_density: { 0.5, 1.0, 2.5 }) {
+            const Nfa aut{ builder::create_random_nfa_tabakov_vardi(num_of_states, 3, transition_density, 0.3) };
+            const Simlib::Util::BinaryRelation forward{ compute_relation(aut) };
+            CHECK(same_relations(forward, reference_simulation(aut, aut.final)));
+            CHECK(same_relations(forward, compute_direct_simulation(aut.delta.freeze(), aut.num_of_states(),
+                                                                     aut.final)));
+
+            const Simlib::Util::BinaryRelation backward{
+                compute_relation(aut, { { "relation", "simulation" }, { "direction", "backward" } }) };
+            Nfa reverted{ revert(aut) };
+            reverted.final = aut.initial;
+            CHECK(same_relations(backward, reference_simulation(reverted, reverted.final)));
+        }
+    }
+
+    SECTION("Backward simulation") {
+        Nfa aut{ 4, { 0, 1 }, { 3 } };
+        aut.delta.add(0, 'a', 2);
+        aut.delta.add(1, 'a', 3);
+        aut.delta.add(1, 'b', 2);
+        aut.delta.add(1, 'b', 3);
+        aut.delta.add(2, 'a', 3);
+        const Simlib::Util::BinaryRelation result{
+            compute_relation(aut, { { "relation", "simulation" }, { "direction", "backward" } }) };
+        CHECK(result.get(2, 3)); // 3 is reached by all words reaching 2.
+        CHECK(!result.get(3, 2)); // 2 is not reached by 'aa'.
+        CHECK(result.get(0, 1));
+        CHECK(!result.get(2, 0));
+    }
+
+    CHECK_THROWS_AS(compute_relation(Nfa{}, { { "relation", "simulation" }, { "direction", "sideways" } }),
+                    std::runtime_error);
+}
+
 TEST_CASE("mata::nfa::reduce_size_by_simulation()")
 {
     Nfa aut;
@@ -2949,6 +3009,96 @@ TEST_CASE("mata::nfa::algorithms::minimize_hopcroft()") {
 
 }
 
+TEST_CASE("mata::nfa::algorithms::minimize_valmari()") {
+    SECTION("empty automaton") {
+        const Nfa result{ minimize_valmari(Nfa{}) };
+        CHECK(result.is_lang_empty());
+        CHECK(result.num_of_states() == 1);
+    }
+
+    SECTION("one state") {
+        Nfa aut(1, { 0 }, { 0 });
+        const Nfa result{ minimize_valmari(aut) };
+        CHECK(result.delta.num_of_transitions() == 0);
+        CHECK(result.num_of_states() == 1);
+        CHECK(result.initial == result.final);
+    }
+
+    SECTION("partial automaton with irrelevant states") {
+        Nfa aut(6, { 0 }, { 2, 5 });
+        aut.delta.add(0, 'a', 1);
+        aut.delta.add(1, 'a', 2);
+        aut.delta.add(1, 'b', 3); // State 3 does not reach a final state.
+        aut.delta.add(3, 'a', 3);
+        aut.delta.add(4, 'a', 5); // States 4 and 5 are unreachable.
+        aut.delta.add(2, 'a', 1);
+        const Nfa result{ minimize_valmari(aut) };
+        CHECK(result.num_of_states() == 3);
+        CHECK(result.delta.num_of_transitions() == 3);
+        CHECK(result.is_deterministic());
+        CHECK(are_equivalent(aut, result));
+    }
+
+    SECTION("empty language") {
+        Nfa aut(3, { 0 }, { 2 });
+        aut.delta.add(0, 'a', 1);
+        aut.delta.add(1, 'a', 0);
+        const Nfa result{ minimize_valmari(aut) };
+        CHECK(result.is_lang_empty());
+        CHECK(result.num_of_states() == 1);
+        CHECK(result.delta.num_of_transitions() == 0);
+    }
+
+    SECTION("difficult") {
+        Nfa aut;
+        aut.initial.insert(0);
+        aut.final.insert(1);
+        aut.final.insert(6);
+        aut.delta.add(0, 0, 1);
+        aut.delta.add(1, 0, 2);
+        aut.delta.add(2, 0, 4);
+        aut.delta.add(4, 1, 5);
+        aut.delta.add(4, 0, 3);
+        aut.delta.add(5, 0, 6);
+        aut.delta.add(3, 0, 1);
+
+        const Nfa aut_brz{ minimize_brzozowski(aut) };
+        const Nfa aut_val{ minimize_valmari(aut) };
+        CHECK(are_equivalent(aut_brz, aut_val));
+        CHECK(aut_brz.num_of_states() == aut_val.num_of_states());
+        CHECK(aut_brz.delta.num_of_transitions() == aut_val.delta.num_of_transitions());
+        CHECK(aut_brz.final.size() == aut_val.final.size());
+    }
+}
+
+TEST_CASE("mata::nfa::minimize() with different algorithms") {
+    std::vector<Nfa> automata{};
+    for (const size_t num_of_states: { 1ul, 5ul, 15ul, 20ul }) {
+        for (const double final_density: { 0.1, 0.5 }) {
+            automata.push_back(builder::create_random_nfa_tabakov_vardi(num_of_states, 3, 1.5, final_density));
+        }
+    }
+    Nfa co_deterministic{ 3, { 0, 1 }, { 2 } };
+    co_deterministic.delta.add(0, 'a', 1);
+    co_deterministic.delta.add(1, 'b', 2);
+    co_deterministic.delta.add(0, 'b', 0);
+    automata.push_back(co_deterministic);
+    automata.push_back(Nfa{});
+
+    for (const Nfa& aut: automata) {
+        const Nfa expected{ minimize(aut) };
+        for (const std::string algorithm: { "hopcroft", "valmari", "auto" }) {
+            const Nfa result{ minimize(aut, { { "algorithm", algorithm } }) };
+            CHECK(result.is_deterministic());
+            CHECK(are_equivalent(result, aut));
+            CHECK(Nfa{ result }.trim().num_of_states() == Nfa{ expected }.trim().num_of_states());
+            CHECK(result.delta.num_of_transitions() == expected.delta.num_of_transitions());
+        }
+    }
+
+    CHECK_THROWS_AS(minimize(co_deterministic, { { "algorithm", "moore" } }), std::runtime_error);
+}
+
 TEST_CASE("mata::nfa::reduce_size_by_residual()") {
     Nfa aut;
     StateRenaming state_renaming;
@@ -3446,6 +3596,68 @@ TEST_CASE("mata::nfa::remove_epsilon()")
     REQUIRE(aut.delta.contains(5, 'a', 9));
 }
 
+TEST_CASE("mata::nfa::remove_epsilon() with epsilon SCCs")
+{
+    SECTION("States of an epsilon cycle share their transitions") {
+        Nfa aut{ 6, { 0 }, { 5 } };
+        aut.delta.add(0, EPSILON, 1);
+        aut.delta.add(1, EPSILON, 2);
+        aut.delta.add(2, EPSILON, 0);
+        aut.delta.add(2, EPSILON, 3);
+        aut.delta.add(3, EPSILON, 5);
+        aut.delta.add(0, 'a', 4);
+        aut.delta.add(1, 'b', 1);
+        aut.delta.add(3, 'c', 0);
+        aut.delta.add(4, EPSILON, 4);
+        aut.delta.add(4, 'a', 5);
+        const Nfa result{ remove_epsilon(aut) };
+        CHECK(result.delta.get_used_symbols().count(EPSILON) == 0);
+        for (const State state: { 0ul, 1ul, 2ul }) {
+            CHECK(result.delta[state] == result.delta[0]);
+            CHECK(result.final.contains(state));
+        }
+        CHECK(result.delta.contains(0, 'a', 4));
+        CHECK(result.delta.contains(2, 'b', 1));
+        CHECK(result.delta.contains(1, 'c', 0));
+        CHECK(result.delta.num_of_transitions() == 3 * 3 + 1 + 1);
+        CHECK(result.final.contains(3));
+        CHECK(!result.final.contains(4));
+        CHECK(result.delta.contains(4, 'a', 5));
+        CHECK(!result.delta.contains(4, EPSILON, 4));
+    }
+
+    SECTION("Closures are the states reachable by epsilon transitions") {
+        Nfa aut{ builder::create_random_nfa_tabakov_vardi(80, 3, 2.0, 0.1) };
+        for (State source{ 0 }; source < 80; source += 2) {
+            aut.delta.add(source, 'c', (source * 13 + 5) % 80);
+            aut.delta.add(source, 'c', (source * 3 + 1) % 80);
+        }
+        const Nfa result{ remove_epsilon(aut, 'c') };
+        for (State state{ 0 }; state < 80; ++state) {
+            // Compute the closure of the state by a search.
+            std::set<State> closure{ state };
+            std::vector<State> worklist{ state };
+            while (!worklist.empty()) {
+                const State closure_state{ worklist.back() };
+                worklist.pop_back();
+                for (const Move& move: aut.delta[closure_state].moves()) {
+                    if (move.symbol == 'c' && closure.insert(move.target).second) { worklist.push_back(move.target); }
+                }
+            }
+            Nfa expected_post{};
+            bool is_final{ false };
+            for (const State closure_state: closure) {
+                is_final = is_final || aut.final.contains(closure_state);
+                for (const Move& move: aut.delta[closure_state].moves()) {
+                    if (move.symbol != 'c') { expected_post.delta.add(state, move.symbol, move.target); }
+                }
+            }
+            CHECK(result.delta[state] == expected_post.delta[state]);
+            CHECK(result.final.contains(state) == is_final);
+        }
+    }
+}
+
 TEST_CASE("Profile mata::nfa::remove_epsilon()", "[.profiling]")
 {
     for (size_t n{}; n < 100000; ++n) {
@@ -4782,3 +4994,495 @@ TEST_CASE("mata::nfa::Nfa::decode_utf8") {
         CHECK(are_equivalent(result, aut.decode_utf8()));
     }
 }
+
+TEST_CASE("mata::nfa::FrozenNfa") {
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+    const FrozenNfa frozen_a{ a };
+    const FrozenNfa frozen_b{ b };
+
+    SECTION("Queries") {
+        CHECK(frozen_a.num_of_states() == a.num_of_states());
+        CHECK(frozen_a.delta.num_of_transitions() == a.delta.num_of_transitions());
+        CHECK(frozen_a.get_useful_states() == a.get_useful_states());
+        CHECK(frozen_b.get_useful_states() == b.get_useful_states());
+        CHECK(frozen_a.distances_from_initial() == a.distances_from_initial());
+        CHECK(frozen_b.distances_to_final() == b.distances_to_final());
+        CHECK(frozen_a.post(StateSet{ 1, 7 }, 'a') == a.post(StateSet{ 1, 7 }, 'a'));
+        for (const Word& word: std::vector<Word>{ {}, { 'a', 'a' }, { 'b', 'a' }, { 'a', 'c' }, { 'a', 'a', 'a' } }) {
+            CHECK(frozen_a.is_in_lang(word) == a.is_in_lang(word));
+            CHECK(frozen_b.is_in_lang(word) == b.is_in_lang(word));
+        }
+
+        const std::vector<State> distances{ frozen_a.distances_to_final() };
+        const Run run{ frozen_a.get_shortest_accepting_run_from_state(1, distances) };
+        CHECK(run.word.size() == distances[1]);
+        CHECK(a.is_in_lang(run.word));
+    }
+
+    SECTION("Algorithms") {
+        CHECK(determinize(frozen_a).is_identical(determinize(a)));
+        CHECK(determinize(frozen_b).is_identical(determinize(b)));
+
+        auto both_final = [&](const Nfa& lhs, const Nfa& rhs) {
+            return [&](const State lhs_state, const State rhs_state) {
+                return lhs.final.contains(lhs_state) && rhs.final.contains(rhs_state);
+            };
+        };
+        CHECK(product(frozen_a, frozen_b, both_final(a, b)).is_identical(product(a, b, both_final(a, b))));
+        CHECK(product(frozen_a, frozen_a, both_final(a, a)).is_identical(product(a, a, both_final(a, a))));
+
+        Run cex{};
+        CHECK(is_included_antichains(frozen_a, frozen_a));
+        CHECK(!is_included_antichains(frozen_a, frozen_b, nullptr, &cex));
+        CHECK(a.is_in_lang(cex));
+        CHECK(!b.is_in_lang(cex));
+        CHECK(is_included_antichains(frozen_b, frozen_a) == is_included_antichains(b, a));
+    }
+}
+
+TEST_CASE("mata::nfa::Nfa::pre()") {
+    Nfa aut{ 4 };
+    aut.initial = { 0 };
+    aut.final = { 3 };
+    aut.delta.add(0, 'a', 1);
+    aut.delta.add(2, 'a', 1);
+    aut.delta.add(0, 'b', 1);
+    aut.delta.add(1, 'a', 3);
+    aut.delta.add(3, 'b', 3);
+
+    SECTION("Queries") {
+        CHECK(std::ranges::equal(aut.pre(1, 'a'), std::vector<State>{ 0, 2 }));
+        CHECK(std::ranges::equal(aut.pre(1, 'b'), std::vector<State>{ 0 }));
+        CHECK(aut.pre(1, 'c').empty());
+        CHECK(aut.pre(0, 'a').empty());
+        CHECK(aut.pre(42, 'a').empty());
+        CHECK(std::ranges::equal(aut.pre(3, 'b'), std::vector<State>{ 3 }));
+
+        const PredecessorIndex& predecessors{ aut.predecessors() };
+        CHECK(predecessors.num_of_transitions() == aut.delta.num_of_transitions());
+        REQUIRE(predecessors.pre(3).size() == 2);
+        CHECK(predecessors.pre(3)[0].symbol == 'a');
+        CHECK(predecessors.pre(3)[1].symbol == 'b');
+        CHECK(&aut.predecessors() == &predecessors);
+    }
+
+    SECTION("Invalidation") {
+        const PredecessorIndex* predecessors{ &aut.predecessors() };
+        aut.delta.add(3, 'a', 1);
+        CHECK(std::ranges::equal(aut.pre(1, 'a'), std::vector<State>{ 0, 2, 3 }));
+        predecessors = &aut.predecessors();
+        aut.delta.remove(0, 'b', 1);
+        CHECK(aut.pre(1, 'b').empty());
+        CHECK(&aut.predecessors() != predecessors);
+        aut.delta.mutable_state_post(2).clear();
+        CHECK(std::ranges::equal(aut.pre(1, 'a'), std::vector<State>{ 0, 3 }));
+    }
+
+    SECTION("Copies") {
+        const PredecessorIndex& predecessors{ aut.predecessors() };
+        const Nfa copy{ aut };
+        CHECK(&copy.predecessors() == &predecessors);
+        Nfa modified{ aut };
+        modified.delta.add(1, 'b', 2);
+        CHECK(std::ranges::equal(modified.pre(2, 'b'), std::vector<State>{ 1 }));
+        CHECK(aut.pre(2, 'b').empty());
+        const Nfa moved{ std::move(modified) };
+        CHECK(std::ranges::equal(moved.pre(2, 'b'), std::vector<State>{ 1 }));
+    }
+
+    SECTION("Backward algorithms") {
+        aut.final.insert(2);
+        aut.delta.add(0, 'c', 2);
+        CHECK(aut.get_terminating_states() == StateSet{ 0, 1, 2, 3 });
+        CHECK(aut.distances_to_final() == std::vector<State>{ 1, 1, 0, 0, Limits::max_state });
+        CHECK(revert(aut).is_identical(simple_revert(aut)));
+        CHECK(revert(revert(aut)).is_identical(aut));
+    }
+}
+
+TEST_CASE("mata::nfa::determinize() with adaptive macrostates") {
+    const ParameterMap adaptive{ { "macrostate", "adaptive" } };
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+
+    SECTION("Determinization") {
+        for (const Nfa& aut: { a, b }) {
+            std::unordered_map<StateSet, State> subset_map{};
+            std::unordered_map<StateSet, State> adaptive_subset_map{};
+            const Nfa expected{ determinize(aut, &subset_map) };
+            const Nfa result{ determinize(aut, &adaptive_subset_map, std::nullopt, adaptive) };
+            CHECK(result.num_of_states() == expected.num_of_states());
+            CHECK(are_equivalent(result, expected));
+            CHECK(adaptive_subset_map.size() == subset_map.size());
+            CHECK(determinize(FrozenNfa{ aut }, nullptr, std::nullopt, adaptive).num_of_states()
+                  == expected.num_of_states());
+        }
+        const Nfa random{ builder::create_random_nfa_tabakov_vardi(200, 2, 3.0, 0.5) };
+        CHECK(are_equivalent(determinize(random, nullptr, std::nullopt, adaptive), determinize(random)));
+
+        size_t num_of_discovered{ 0 };
+        determinize(a, nullptr, [&](const Nfa&, const State, const StateSet&) { return ++num_of_discovered < 2; },
+                    adaptive);
+        CHECK(num_of_discovered == 2);
+        CHECK_THROWS_AS(determinize(a, nullptr, std::nullopt, { { "macrostate", "bitset" } }), std::runtime_error);
+    }
+
+    SECTION("Antichains") {
+        const ParameterMap antichains_adaptive{ { "algorithm", "antichains" }, { "macrostate", "adaptive" } };
+        OnTheFlyAlphabet alphabet{ { "a", 'a' }, { "b", 'b' }, { "c", 'c' } };
+        CHECK(is_included(a, a, nullptr, antichains_adaptive));
+        CHECK(is_included(a, b, nullptr, antichains_adaptive) == is_included(a, b));
+        CHECK(is_included(b, a, nullptr, antichains_adaptive) == is_included(b, a));
+        Run cex{};
+        if (!is_included(a, b, &cex, nullptr, antichains_adaptive)) {
+            CHECK(a.is_in_lang(cex));
+            CHECK(!b.is_in_lang(cex));
+        }
+        CHECK(are_equivalent(a, a, antichains_adaptive));
+        CHECK(a.is_universal(alphabet, antichains_adaptive) == a.is_universal(alphabet));
+
+        Nfa universal{ 1, { 0 }, { 0 } };
+        for (const Symbol symbol: { Symbol{ 'a' }, Symbol{ 'b' }, Symbol{ 'c' } }) { universal.delta.add(0, symbol, 0); }
+        CHECK(universal.is_universal(alphabet, antichains_adaptive));
+        REQUIRE(!b.is_universal(alphabet));
+        CHECK(!b.is_universal(alphabet, &cex, antichains_adaptive));
+        CHECK(!b.is_in_lang(cex));
+
+        const Nfa random{ builder::create_random_nfa_tabakov_vardi(100, 2, 2.0, 0.3) };
+        const Nfa other_random{ builder::create_random_nfa_tabakov_vardi(100, 2, 2.0, 0.3) };
+        CHECK(is_included(random, other_random, nullptr, antichains_adaptive) == is_included(random, other_random));
+    }
+}
+
+TEST_CASE("mata::nfa::determinize() with multiple threads") {
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+    const Nfa random{ builder::create_random_nfa_tabakov_vardi(200, 2, 3.0, 0.5) };
+
+    SECTION("The result equals the sequential result") {
+        for (const Nfa& aut: { a, b, random, Nfa{}, Nfa{ 1, { 0 }, { 0 } } }) {
+            std::unordered_map<StateSet, State> subset_map{};
+            const Nfa expected{ determinize(aut, &subset_map) };
+            for (const std::string threads: { "1", "2", "4", "0" }) {
+                std::unordered_map<StateSet, State> parallel_subset_map{};
+                const Nfa result{ determinize(aut, &parallel_subset_map, std::nullopt, { { "threads", threads } }) };
+                CHECK(result.num_of_states() == expected.num_of_states());
+                CHECK(result.delta == expected.delta);
+                CHECK(result.initial == expected.initial);
+                CHECK(result.final == expected.final);
+                CHECK(parallel_subset_map == subset_map);
+                CHECK(determinize(FrozenNfa{ aut }, nullptr, std::nullopt, { { "threads", threads } }).delta
+                      == expected.delta);
+            }
+        }
+    }
+
+    SECTION("Macrostate discovery is sequential") {
+        size_t num_of_discovered{ 0 };
+        determinize(a, nullptr, [&](const Nfa&, const State, const StateSet&) { return ++num_of_discovered < 2; },
+                    { { "threads", "4" } });
+        CHECK(num_of_discovered == 2);
+    }
+
+    SECTION("Invalid parameters") {
+        CHECK_THROWS_AS(determinize(a, nullptr, std::nullopt, { { "threads", "many" } }), std::runtime_error);
+        CHECK_THROWS_AS(determinize(a, nullptr, std::nullopt, { { "threads", "2x" } }), std::runtime_error);
+        CHECK_THROWS_AS(determinize(a, nullptr, std::nullopt, { { "threads", "2" }, { "macrostate", "adaptive" } }),
+                        std::runtime_error);
+    }
+}
+
+TEST_CASE("mata::nfa::determinize() with epsilon closures") {
+    const ParameterMap with_epsilon{ { "first_epsilon", std::to_string(EPSILON) } };
+    Nfa aut{ 6 };
+    aut.initial = { 0 };
+    aut.final = { 5 };
+    aut.delta.add(0, EPSILON, 1);
+    aut.delta.add(1, 'a', 2);
+    aut.delta.add(1, EPSILON, 3);
+    aut.delta.add(3, EPSILON, 1);
+    aut.delta.add(3, 'b', 4);
+    aut.delta.add(2, EPSILON, 4);
+    aut.delta.add(4, 'a', 5);
+    aut.delta.add(4, EPSILON, 0);
+    aut.delta.add(5, EPSILON, 5);
+
+    Nfa regex{};
+    create_nfa(&regex, "(ab|a*)*(b+c)?", true, EPSILON);
+    Nfa random_with_epsilon{ builder::create_random_nfa_tabakov_vardi(60, 3, 1.5, 0.3) };
+    for (State source{ 0 }; source < 60; source += 3) { random_with_epsilon.delta.add(source, EPSILON, (source * 7) % 60); }
+
+    SECTION("The language equals the language after removing epsilon transitions") {
+        for (const Nfa& nfa: { aut, regex, random_with_epsilon }) {
+            const Nfa expected{ determinize(remove_epsilon(nfa)) };
+            for (const ParameterMap& params: {
+                     with_epsilon, ParameterMap{ { "first_epsilon", std::to_string(EPSILON) }, { "threads", "2" } },
+                     ParameterMap{ { "first_epsilon", std::to_string(EPSILON) }, { "macrostate", "adaptive" } } }) {
+                const Nfa result{ determinize(nfa, nullptr, std::nullopt, params) };
+                CHECK(result.is_deterministic());
+                CHECK(result.delta.get_used_symbols().count(EPSILON) == 0);
+                CHECK(are_equivalent(result, expected));
+                CHECK(are_equivalent(determinize(FrozenNfa{ nfa }, nullptr, std::nullopt, params), expected));
+            }
+        }
+    }
+
+    SECTION("Range of epsilon symbols") {
+        // Symbols 'c' and 'd' are epsilons.
+        Nfa nfa{ 4, { 0 }, { 3 } };
+        nfa.delta.add(0, 'c', 1);
+        nfa.delta.add(1, 'a', 2);
+        nfa.delta.add(2, 'd', 3);
+        nfa.delta.add(0, 'b', 3);
+        const Nfa result{
+            determinize(nfa, nullptr, std::nullopt, { { "first_epsilon", std::to_string(Symbol{ 'c' }) } }) };
+        CHECK(result.is_deterministic());
+        CHECK(result.delta.get_used_symbols() == OrdVector<Symbol>{ 'a', 'b' });
+        CHECK(result.is_in_lang(Run{ { 'a' }, {} }));
+        CHECK(result.is_in_lang(Run{ { 'b' }, {} }));
+        CHECK(!result.is_in_lang(Run{ {}, {} }));
+        CHECK_THROWS_AS(determinize(nfa, nullptr, std::nullopt, { { "first_epsilon", "c" } }), std::runtime_error);
+    }
+
+    SECTION("Subset map contains closed macrostates") {
+        std::unordered_map<StateSet, State> subset_map{};
+        determinize(aut, &subset_map, std::nullopt, with_epsilon);
+        CHECK(subset_map.contains(StateSet{ 0, 1, 3 }));
+        CHECK(subset_map.at(StateSet{ 0, 1, 3 }) == 0);
+    }
+
+    SECTION("Language difference and complement") {
+        for (const Nfa& nfa: { aut, regex, random_with_epsilon }) {
+            const Nfa nfa_without_epsilon{ remove_epsilon(nfa) };
+            CHECK(are_equivalent(lang_difference(nfa, aut, std::nullopt, EPSILON),
+                                 lang_difference(nfa_without_epsilon, remove_epsilon(aut))));
+            CHECK(are_equivalent(lang_difference(aut, nfa, std::nullopt, EPSILON),
+                                 lang_difference(remove_epsilon(aut), nfa_without_epsilon)));
+            const OrdVector<Symbol> symbols{ 'a', 'b', 'c', 0, 1, 2 };
+            const Nfa complemented{ complement(nfa, symbols, { { "algorithm", "classical" },
+                                                               { "first_epsilon", std::to_string(EPSILON) } }) };
+            CHECK(are_equivalent(complemented, complement(nfa_without_epsilon, symbols)));
+        }
+        CHECK_THROWS_AS(complement(aut, OrdVector<Symbol>{ 'a', 'b' }, { { "algorithm", "brzozowski" },
+                                                                        { "first_epsilon", "0" } }),
+                        std::runtime_error);
+    }
+}
+
+TEST_CASE("mata::nfa::is_included() with simulation-enhanced antichains") {
+    const ParameterMap antichains_sim{ { "algorithm", "antichains-sim" } };
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+    OnTheFlyAlphabet alphabet{ { "a", 'a' }, { "b", 'b' }, { "c", 'c' } };
+
+    SECTION("Inclusion and equivalence") {
+        CHECK(is_included(a, a, nullptr, antichains_sim));
+        CHECK(is_included(a, b, nullptr, antichains_sim) == is_included(a, b));
+        CHECK(is_included(b, a, nullptr, antichains_sim) == is_included(b, a));
+        CHECK(is_included(a, union_nondet(a, b), nullptr, antichains_sim));
+        CHECK(are_equivalent(a, a, antichains_sim));
+        CHECK(are_equivalent(a, reduce(a), antichains_sim));
+        CHECK(!are_equivalent(a, b, antichains_sim));
+
+        for (size_t i{ 0 }; i < 10; ++i) {
+            const Nfa lhs{ builder::create_random_nfa_tabakov_vardi(30, 2, 1.5, 0.3) };
+            const Nfa rhs{ builder::create_random_nfa_tabakov_vardi(30, 2, 2.5, 0.5) };
+            for (const auto& [smaller, bigger]: { std::pair{ lhs, rhs }, std::pair{ rhs, lhs } }) {
+                Run cex{};
+                const bool expected{ is_included(smaller, bigger) };
+                CHECK(is_included(smaller, bigger, &cex, nullptr, antichains_sim) == expected);
+                if (!expected) {
+                    CHECK(smaller.is_in_lang(cex));
+                    CHECK(!bigger.is_in_lang(cex));
+                }
+            }
+            CHECK(is_included(lhs, union_nondet(rhs, lhs), nullptr, antichains_sim));
+        }
+    }
+
+    SECTION("Universality") {
+        Nfa universal{ 2, { 0 }, { 0, 1 } };
+        for (const Symbol symbol: { Symbol{ 'a' }, Symbol{ 'b' }, Symbol{ 'c' } }) {
+            universal.delta.add(0, symbol, 1);
+            universal.delta.add(1, symbol, 0);
+            universal.delta.add(0, symbol, 0);
+        }
+        CHECK(universal.is_universal(alphabet, antichains_sim));
+        CHECK(a.is_universal(alphabet, antichains_sim) == a.is_universal(alphabet));
+        Run cex{};
+        REQUIRE(!b.is_universal(alphabet));
+        CHECK(!b.is_universal(alphabet, &cex, antichains_sim));
+        CHECK(!b.is_in_lang(cex));
+
+        const EnumAlphabet binary{ 0, 1 };
+        for (size_t i{ 0 }; i < 10; ++i) {
+            const Nfa random{ builder::create_random_nfa_tabakov_vardi(20, 2, 3.0, 0.8) };
+            CHECK(random.is_universal(binary, antichains_sim) == random.is_universal(binary));
+            if (!random.is_universal(binary, &cex, antichains_sim)) { CHECK(!random.is_in_lang(cex)); }
+        }
+    }
+}
+
+TEST_CASE("mata::nfa::is_included() and mata::nfa::are_equivalent() with bisimulation up to congruence") {
+    const std::vector<ParameterMap> hkc_params{ { { "algorithm", "hkc" } }, { { "algorithm", "hkc-sim" } } };
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+    OnTheFlyAlphabet alphabet{ { "a", 'a' }, { "b", 'b' }, { "c", 'c' } };
+
+    SECTION("Equivalence") {
+        for (const ParameterMap& hkc: hkc_params) {
+            CHECK(are_equivalent(a, a, hkc));
+            CHECK(are_equivalent(a, determinize(a), hkc));
+            CHECK(are_equivalent(a, reduce(a), hkc));
+            CHECK(!are_equivalent(a, b, hkc));
+            CHECK(are_equivalent(Nfa{}, Nfa{ 2, { 0 }, { 1 } }, hkc));
+        }
+
+        for (const bool up_to_similarity: { false, true }) {
+            Run cex{};
+            CHECK(!algorithms::are_equivalent_hkc(a, b, &cex, up_to_similarity));
+            CHECK(a.is_in_lang(cex) != b.is_in_lang(cex));
+            CHECK(cex.path.empty());
+        }
+
+        for (size_t i{ 0 }; i < 10; ++i) {
+            const Nfa random{ builder::create_random_nfa_tabakov_vardi(30, 2, 2.0, 0.3) };
+            const Nfa other{ builder::create_random_nfa_tabakov_vardi(10, 2, 1.5, 0.3) };
+            for (const ParameterMap& hkc: hkc_params) {
+                CHECK(are_equivalent(random, minimize(random), hkc));
+                CHECK(are_equivalent(random, other, hkc) == are_equivalent(random, other));
+            }
+        }
+    }
+
+    SECTION("Inclusion") {
+        for (const ParameterMap& hkc: hkc_params) {
+            CHECK(is_included(a, a, nullptr, hkc));
+            CHECK(is_included(a, b, nullptr, hkc) == is_included(a, b));
+            CHECK(is_included(b, a, nullptr, hkc) == is_included(b, a));
+            CHECK(is_included(a, union_nondet(a, b), nullptr, hkc));
+        }
+
+        for (size_t i{ 0 }; i < 10; ++i) {
+            const Nfa lhs{ builder::create_random_nfa_tabakov_vardi(30, 2, 1.5, 0.3) };
+            const Nfa rhs{ builder::create_random_nfa_tabakov_vardi(30, 2, 2.5, 0.5) };
+            for (const auto& [smaller, bigger]: { std::pair{ lhs, rhs }, std::pair{ rhs, lhs } }) {
+                const bool expected{ is_included(smaller, bigger) };
+                for (const ParameterMap& hkc: hkc_params) {
+                    Run cex{};
+                    CHECK(is_included(smaller, bigger, &cex, nullptr, hkc) == expected);
+                    if (!expected) {
+                        CHECK(smaller.is_in_lang(cex));
+                        CHECK(!bigger.is_in_lang(cex));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Universality") {
+        Nfa universal{ 1, { 0 }, { 0 } };
+        for (const Symbol symbol: { Symbol{ 'a' }, Symbol{ 'b' }, Symbol{ 'c' } }) { universal.delta.add(0, symbol, 0); }
+        REQUIRE(!b.is_universal(alphabet));
+        for (const ParameterMap& hkc: hkc_params) {
+            CHECK(universal.is_universal(alphabet, hkc));
+            Run cex{};
+            CHECK(!b.is_universal(alphabet, &cex, hkc));
+            CHECK(!b.is_in_lang(cex));
+        }
+    }
+}
+
+TEST_CASE("mata::nfa::is_included() with multiple threads") {
+    Nfa a{ 15 };
+    FILL_WITH_AUT_A(a);
+    Nfa b{ 15 };
+    FILL_WITH_AUT_B(b);
+
+    for (const std::string threads: { "2", "4" }) {
+        const ParameterMap params{ { "algorithm", "antichains" }, { "threads", threads } };
+        CHECK(is_included(a, a, nullptr, params));
+        CHECK(is_included(a, union_nondet(a, b), nullptr, params));
+        CHECK(is_included(a, b, nullptr, params) == is_included(a, b));
+        CHECK(is_included(b, a, nullptr, params) == is_included(b, a));
+        CHECK(are_equivalent(a, reduce(a), params));
+        CHECK(!are_equivalent(a, b, params));
+
+        for (size_t i{ 0 }; i < 10; ++i) {
+            const Nfa lhs{ builder::create_random_nfa_tabakov_vardi(50, 2, 1.5, 0.3) };
+            const Nfa rhs{ builder::create_random_nfa_tabakov_vardi(50, 2, 2.5, 0.5) };
+            for (const auto& [smaller, bigger]: { std::pair{ lhs, rhs }, std::pair{ rhs, lhs } }) {
+                Run cex{};
+                const bool expected{ is_included(smaller, bigger) };
+                CHECK(is_included(smaller, bigger, &cex, nullptr, params) == expected);
+                if (!expected) {
+                    CHECK(smaller.is_in_lang(cex));
+                    CHECK(!bigger.is_in_lang(cex));
+                }
+            }
+            CHECK(is_included(lhs, union_nondet(rhs, lhs), nullptr, params));
+        }
+    }
+
+    CHECK_THROWS_AS(is_included(a, b, nullptr, { { "algorithm", "naive" }, { "threads", "2" } }), std::runtime_error);
+    CHECK_THROWS_AS(is_included(a, b, nullptr, { { "algorithm", "antichains" }, { "threads", "x" } }),
+                    std::runtime_error);
+}
+
+TEST_CASE("mata::nfa::is_universal() with large alphabets") {
+    const std::vector<ParameterMap> params{
+        { { "algorithm", "antichains" } },
+        { { "algorithm", "antichains" }, { "macrostate", "adaptive" } },
+        { { "algorithm", "antichains-sim" } },
+    };
+
+    constexpr Symbol NUM_OF_SYMBOLS{ 10000 };
+    std::vector<Symbol> symbols(NUM_OF_SYMBOLS);
+    std::iota(symbols.begin(), symbols.end(), 0);
+    const EnumAlphabet alphabet(symbols.begin(), symbols.end());
+
+    // The language of 'aut' is all words, split between two states by the parity of the last symbol.
+    Nfa aut{ 3, { 0 }, { 0, 1, 2 } };
+    for (const Symbol symbol: symbols) {
+        for (State source{ 0 }; source < 3; ++source) { aut.delta.add(source, symbol, symbol % 2 == 0 ? 1 : 2); }
+    }
+    // Symbols outside the alphabet are ignored.
+    aut.delta.add(1, NUM_OF_SYMBOLS + 1, 0);
+
+    for (const ParameterMap& param: params) {
+        Run cex{};
+        CHECK(aut.is_universal(alphabet, &cex, param));
+    }
+
+    // A symbol missing from the state reached over even symbols makes the automaton non-universal.
+    Nfa missing{ aut };
+    missing.delta.remove(1, 5000, 1);
+    for (const ParameterMap& param: params) {
+        Run cex{};
+        CHECK(!missing.is_universal(alphabet, &cex, param));
+        CHECK(cex.word.size() == 2);
+        CHECK(!missing.is_in_lang(cex));
+    }
+
+    for (size_t i{ 0 }; i < 10; ++i) {
+        const Nfa random{ builder::create_random_nfa_tabakov_vardi(30, 3, 3.0, 0.8) };
+        const EnumAlphabet random_alphabet{ 0, 1, 2 };
+        const bool expected{ random.is_universal(random_alphabet, { { "algorithm", "naive" } }) };
+        for (const ParameterMap& param: params) {
+            Run cex{};
+            CHECK(random.is_universal(random_alphabet, &cex, param) == expected);
+            if (!expected) { CHECK(!random.is_in_lang(cex)); }
+        }
+    }
+}
@@ -1,6 +1,8 @@
 /* tests-ord-vector.cc -- tests of OrdVector
  */
 
+#include <random>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
@@ -113,3 +115,76 @@ TEST_CASE("mata::utils::OrdVector::difference()") {
         CHECK(set1.difference(set2) == mata::utils::OrdVector<int>{ 1, 2 });
     }
 }
+
+namespace {
+/// Random sorted vector of @p size distinct elements from [0, @p universe).
+template<class T>
+std::vector<T> random_sorted_set(std::mt19937& generator, const size_t size, const T universe) {
+    std::uniform_int_distribution<T> distribution{ 0, universe - 1 };
+    std::vector<T> set{};
+    while (set.size() < size) {
+        set.push_back(distribution(generator));
+        sort_and_rmdupl(set);
+    }
+    return set;
+}
+
+template<class T>
+void check_set_kernels(const set_kernels::Isa isa) {
+    std::mt19937 generator{ 42 };
+    for (const size_t lhs_size: std::initializer_list<size_t>{ 0, 1, 3, 4, 7, 8, 9, 16, 31, 100 }) {
+        for (const size_t rhs_size: std::initializer_list<size_t>{ 0, 1, 2, 5, 8, 13, 33, 100 }) {
+            for (const T universe: { T{ 128 }, T{ 1024 }, T{ 100000 } }) {
+                const std::vector<T> lhs{ random_sorted_set(generator, lhs_size, universe) };
+                const std::vector<T> rhs{ random_sorted_set(generator, rhs_size, universe) };
+                std::vector<T> expected{};
+                std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+
+                std::vector<T> result(std::min(lhs_size, rhs_size));
+                result.resize(set_kernels::intersection(lhs.data(), lhs.size(), rhs.data(), rhs.size(), result.data(), isa));
+                CHECK(result == expected);
+                CHECK(set_kernels::intersects(lhs.data(), lhs.size(), rhs.data(), rhs.size(), isa) == !expected.empty());
+                CHECK(set_kernels::is_subset(lhs.data(), lhs.size(), rhs.data(), rhs.size(), isa)
+                      == (expected.size() == lhs.size()));
+                CHECK(set_kernels::is_subset(expected.data(), expected.size(), lhs.data(), lhs.size(), isa));
+                CHECK(set_kernels::is_subset(expected.data(), expected.size(), rhs.data(), rhs.size(), isa));
+                CHECK(set_kernels::is_subset(lhs.data(), lhs.size(), lhs.data(), lhs.size(), isa));
+            }
+        }
+    }
+}
+} // namespace.
+
+TEST_CASE("mata::utils::set_kernels") {
+    for (const set_kernels::Isa isa: { set_kernels::Isa::Scalar, set_kernels::Isa::Sse42, set_kernels::Isa::Avx2 }) {
+        if (!set_kernels::is_supported(isa)) { continue; }
+        check_set_kernels<uint32_t>(isa);
+        check_set_kernels<uint64_t>(isa);
+    }
+
+    SECTION("Blocks with all-pairs matches") {
+        // Every element of a block of lhs matches an element of a different block of rhs.
+        const std::vector<uint32_t> lhs{ 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30 };
+        const std::vector<uint32_t> rhs{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+                                         22, 23, 24, 25, 26, 27, 28, 29, 30, 31 };
+        std::vector<uint32_t> result(lhs.size());
+        result.resize(set_kernels::intersection(lhs.data(), lhs.size(), rhs.data(), rhs.size(), result.data()));
+        CHECK(result == lhs);
+        CHECK(set_kernels::is_subset(lhs.data(), lhs.size(), rhs.data(), rhs.size()));
+        CHECK(!set_kernels::is_subset(rhs.data(), rhs.size(), lhs.data(), lhs.size()));
+    }
+}
+
+TEST_CASE("mata::utils::OrdVector set operations") {
+    using OrdVectorT = OrdVector<unsigned long>;
+    const OrdVectorT set1{ 1, 3, 5, 7, 9, 11, 13, 15, 17 };
+    const OrdVectorT set2{ 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    CHECK(set1.intersection(set2) == OrdVectorT{ 3, 5, 7, 9, 11 });
+    CHECK(OrdVectorT::set_union(set1, set2)
+          == OrdVectorT{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 17 });
+    CHECK(!set1.is_intersection_empty_with(set2));
+    CHECK(!are_disjoint(set1, set2));
+    CHECK(set1.is_intersection_empty_with(OrdVectorT{ 0, 2, 4, 18 }));
+    CHECK(OrdVectorT{ 3, 5, 17 }.is_subset_of(set1));
+    CHECK(!OrdVectorT{ 3, 5, 16 }.is_subset_of(set1));
+}
@@ -0,0 +1,78 @@
+/* tests-pool-allocator.cc -- tests of PoolAllocator
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/utils/pool-allocator.hh"
+#include "mata/utils/small-vector.hh"
+
+using namespace mata::utils;
+
+TEST_CASE("mata::utils::PoolAllocator") {
+    SECTION("Freed blocks are reused") {
+        void* const block{ pool::allocate(24) };
+        CHECK(reinterpret_cast<uintptr_t>(block) % pool::GRANULARITY == 0);
+        pool::deallocate(block, 24);
+        // Sizes of the same size class share the free list.
+        void* const reused{ pool::allocate(32) };
+        CHECK(reused == block);
+        void* const other{ pool::allocate(32) };
+        CHECK(other != reused);
+        pool::deallocate(reused, 32);
+        pool::deallocate(other, 32);
+    }
+
+    SECTION("Large blocks") {
+        const size_t num_of_chunks{ pool::statistics().num_of_chunks };
+        void* const block{ pool::allocate(pool::MAX_BLOCK_SIZE + 1) };
+        CHECK(block != nullptr);
+        pool::deallocate(block, pool::MAX_BLOCK_SIZE + 1);
+        CHECK(pool::statistics().num_of_chunks == num_of_chunks);
+    }
+
+    SECTION("Containers") {
+        std::vector<unsigned, PoolAllocator<unsigned>> vector{};
+        SmallVector<unsigned, 2, PoolAllocator<unsigned>> small_vector{};
+        for (unsigned number{ 0 }; number < 1000; ++number) {
+            vector.push_back(number);
+            small_vector.push_back(number);
+        }
+        CHECK(!small_vector.is_inline());
+        CHECK(std::equal(vector.begin(), vector.end(), small_vector.begin(), small_vector.end()));
+        const std::vector<unsigned, PoolAllocator<unsigned>> copy{ vector };
+        CHECK(copy == vector);
+        CHECK(pool::statistics().num_of_reserved_bytes == pool::statistics().num_of_chunks * pool::CHUNK_SIZE);
+        CHECK(pool::statistics().num_of_chunks >= 1);
+    }
+
+    SECTION("Blocks freed by other threads") {
+        std::vector<void*> blocks{};
+        std::thread allocating_thread{ [&] {
+            for (size_t index{ 0 }; index < 100; ++index) { blocks.push_back(pool::allocate(48)); }
+        } };
+        allocating_thread.join();
+        for (void* const block: blocks) { pool::deallocate(block, 48); }
+        CHECK(pool::allocate(48) == blocks.back());
+        pool::deallocate(blocks.back(), 48);
+
+        // Blocks freed by a finished thread are reused by the other threads.
+        blocks.clear();
+        std::thread freeing_thread{ [&] {
+            for (size_t index{ 0 }; index < 100; ++index) { blocks.push_back(pool::allocate(1000)); }
+            for (void* const block: blocks) { pool::deallocate(block, 1000); }
+        } };
+        freeing_thread.join();
+        void* reused{ nullptr };
+        std::thread reusing_thread{ [&] {
+            reused = pool::allocate(1000);
+            pool::deallocate(reused, 1000);
+        } };
+        reusing_thread.join();
+        CHECK(std::find(blocks.begin(), blocks.end(), reused) != blocks.end());
+    }
+}
@@ -0,0 +1,56 @@
+/* tests-set-arena.cc -- tests of SetArena
+ */
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/utils/set-arena.hh"
+
+using namespace mata::utils;
+
+TEST_CASE("mata::utils::SetArena") {
+    using Arena = SetArena<unsigned long>;
+    using Elements = std::vector<unsigned long>;
+
+    SECTION("Interning") {
+        Arena arena{};
+        CHECK(arena.empty());
+        CHECK(!arena.find(Elements{ 1, 2 }).has_value());
+
+        const auto [handle, inserted]{ arena.insert(Elements{ 1, 2, 3 }) };
+        CHECK(handle == 0);
+        CHECK(inserted);
+        CHECK(arena.insert(Elements{}) == std::pair<Arena::Handle, bool>{ 1, true });
+        CHECK(arena.insert(Elements{ 1, 2 }) == std::pair<Arena::Handle, bool>{ 2, true });
+        CHECK(arena.insert(Elements{ 1, 2, 3 }) == std::pair<Arena::Handle, bool>{ 0, false });
+        CHECK(arena.insert(Elements{}) == std::pair<Arena::Handle, bool>{ 1, false });
+        CHECK(arena.size() == 3);
+        CHECK(arena.num_of_elements() == 5);
+        CHECK(std::ranges::equal(arena[0], Elements{ 1, 2, 3 }));
+        CHECK(arena[1].empty());
+        CHECK(arena.find(Elements{ 1, 2 }) == 2);
+        CHECK(!arena.find(Elements{ 2, 3 }).has_value());
+    }
+
+    SECTION("Incremental hash") {
+        size_t hash{ 0 };
+        for (const unsigned long number: { 7ul, 3ul, 5ul }) { hash ^= Arena::element_hash(number); }
+        CHECK(hash == Arena::hash(Elements{ 3, 5, 7 }));
+        Arena arena{};
+        CHECK(arena.insert(Elements{ 3, 5, 7 }, hash).second);
+        CHECK(!arena.insert(Elements{ 3, 5, 7 }).second);
+    }
+
+    SECTION("Many sets") {
+        Arena arena{};
+        for (unsigned long number{ 0 }; number < 1000; ++number) {
+            CHECK(arena.insert(Elements{ number, number + 1 }).first == number);
+        }
+        for (unsigned long number{ 0 }; number < 1000; ++number) {
+            CHECK(arena.find(Elements{ number, number + 1 }) == number);
+            CHECK(std::ranges::equal(arena[static_cast<Arena::Handle>(number)], Elements{ number, number + 1 }));
+        }
+        CHECK(arena.size() == 1000);
+    }
+}
@@ -0,0 +1,83 @@
+/* tests-small-vector.cc -- tests of SmallVector
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/utils/small-vector.hh"
+#include "mata/utils/ord-vector.hh"
+
+using namespace mata::utils;
+
+TEST_CASE("mata::utils::SmallVector") {
+    using SmallVectorT = SmallVector<int, 2>;
+
+    SECTION("Inline and heap storage") {
+        SmallVectorT vector{};
+        CHECK(vector.empty());
+        CHECK(vector.is_inline());
+        vector.push_back(1);
+        vector.push_back(2);
+        CHECK(vector.is_inline());
+        CHECK(vector.capacity() == 2);
+        vector.push_back(3);
+        CHECK(!vector.is_inline());
+        CHECK(vector.size() == 3);
+        CHECK(vector == SmallVectorT{ 1, 2, 3 });
+        vector.clear();
+        CHECK(vector.empty());
+        CHECK(!vector.is_inline());
+    }
+
+    SECTION("Insert and erase") {
+        SmallVectorT vector{ 1, 4 };
+        vector.insert(vector.begin() + 1, 2);
+        CHECK(vector == SmallVectorT{ 1, 2, 4 });
+        const std::vector<int> inserted{ 5, 6 };
+        vector.insert(vector.end(), inserted.begin(), inserted.end());
+        CHECK(vector == SmallVectorT{ 1, 2, 4, 5, 6 });
+        vector.erase(vector.begin());
+        CHECK(vector == SmallVectorT{ 2, 4, 5, 6 });
+        vector.erase(vector.begin() + 1, vector.begin() + 3);
+        CHECK(vector == SmallVectorT{ 2, 6 });
+        vector.pop_back();
+        CHECK(vector.back() == 2);
+        vector.resize(3, 7);
+        CHECK(vector == SmallVectorT{ 2, 7, 7 });
+        vector.resize(1);
+        CHECK(vector == SmallVectorT{ 2 });
+    }
+
+    SECTION("Copy and move") {
+        for (const SmallVectorT& original: { SmallVectorT{ 1 }, SmallVectorT{ 1, 2, 3, 4 } }) {
+            SmallVectorT copy{ original };
+            CHECK(copy == original);
+            SmallVectorT moved{ std::move(copy) };
+            CHECK(moved == original);
+            CHECK(copy.empty());
+            SmallVectorT assigned{ 5, 6, 7 };
+            assigned = original;
+            CHECK(assigned == original);
+            assigned = std::move(moved);
+            CHECK(assigned == original);
+            CHECK(static_cast<std::vector<int>>(assigned) == std::vector<int>(original.begin(), original.end()));
+        }
+    }
+
+    SECTION("Ordered vector with inline storage") {
+        using SmallOrdVector = OrdVector<int, SmallVectorT>;
+        SmallOrdVector set{ 3, 1, 2, 1 };
+        CHECK(set == SmallOrdVector{ 1, 2, 3 });
+        CHECK(set == OrdVector<int>{ 1, 2, 3 });
+        set.insert(0);
+        set.insert(OrdVector<int>{ 2, 5 });
+        CHECK(set == OrdVector<int>{ 0, 1, 2, 3, 5 });
+        CHECK(set.contains(5));
+        CHECK(!set.contains(4));
+        CHECK(SmallOrdVector{ 1, 5 }.is_subset_of(set));
+        CHECK(OrdVector<int>{ 1, 5 }.is_subset_of(set));
+        CHECK(are_disjoint(set, OrdVector<int>{ 4, 6 }));
+        const OrdVector<int> converted{ set };
+        CHECK(converted == OrdVector<int>{ 0, 1, 2, 3, 5 });
+        CHECK(std::hash<SmallOrdVector>{}(set) == std::hash<OrdVector<int>>{}(converted));
+    }
+}
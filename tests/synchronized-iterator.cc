@@ -110,6 +110,22 @@ TEST_CASE("mata::utils::SynchronizedIterator")
         REQUIRE(*current[1]==2);
         REQUIRE(*current[2]==2);
         REQUIRE(!iu.advance());
+
+        // Position[0] advances when synchronizing with a later position, the earlier positions have to follow.
+        iu.reset();
+        OrdVector<int> v6{1,3};
+        OrdVector<int> v7{3};
+
+        push_back(iu,v6);
+        push_back(iu,v6);
+        push_back(iu,v7);
+
+        REQUIRE(iu.advance());
+        current = iu.get_current();
+        REQUIRE(*current[0]==3);
+        REQUIRE(*current[1]==3);
+        REQUIRE(*current[2]==3);
+        REQUIRE(!iu.advance());
     }
 
     SECTION("SynchronizedExistentialIterator, basic functionality")
@@ -0,0 +1,70 @@
+/* tests-work-stealing-queues.cc -- tests of WorkStealingQueues
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "mata/utils/work-stealing-queues.hh"
+
+using namespace mata::utils;
+
+TEST_CASE("mata::utils::WorkStealingQueues") {
+    SECTION("Single worker") {
+        WorkStealingQueues<int> queues{ 1 };
+        queues.push(0, 1);
+        queues.push(0, 2);
+        // Own tasks are popped in the reversed order of pushing.
+        CHECK(queues.pop(0) == 2);
+        queues.task_done();
+        CHECK(queues.pop(0) == 1);
+        queues.task_done();
+        CHECK(!queues.pop(0).has_value());
+    }
+
+    SECTION("Stealing") {
+        WorkStealingQueues<int> queues{ 2 };
+        queues.push(0, 1);
+        queues.push(0, 2);
+        // Stolen tasks are the oldest ones.
+        CHECK(queues.pop(1) == 1);
+        CHECK(queues.pop(0) == 2);
+        queues.task_done();
+        queues.task_done();
+        CHECK(!queues.pop(1).has_value());
+    }
+
+    SECTION("Tree of tasks") {
+        // Each task n > 0 creates tasks n - 1 and n - 1, hence task n stands for 2^(n+1) - 1 tasks.
+        constexpr size_t NUM_OF_WORKERS{ 4 };
+        WorkStealingQueues<unsigned> queues{ NUM_OF_WORKERS };
+        std::atomic<size_t> num_of_processed{ 0 };
+        queues.push(0, 12);
+        auto work = [&](const size_t worker) {
+            while (std::optional<unsigned> task{ queues.pop(worker) }) {
+                if (*task > 0) {
+                    queues.push(worker, *task - 1);
+                    queues.push(worker, *task - 1);
+                }
+                ++num_of_processed;
+                queues.task_done();
+            }
+        };
+        {
+            std::vector<std::jthread> workers{};
+            for (size_t worker{ 1 }; worker < NUM_OF_WORKERS; ++worker) { workers.emplace_back(work, worker); }
+            work(0);
+        }
+        CHECK(num_of_processed == (size_t{ 1 } << 13) - 1);
+    }
+
+    SECTION("Cancellation") {
+        WorkStealingQueues<int> queues{ 2 };
+        queues.push(0, 1);
+        queues.cancel();
+        CHECK(queues.is_cancelled());
+        CHECK(!queues.pop(0).has_value());
+    }
+}